@@ -24,6 +24,7 @@ public:
   int debug() const { return debugLevel_; }
 
   double tolerance() const { return tolerance_; }
+  int    threads() const { return threadCount_; }
   bool   match_node_ids() const { return matchNodeIds_; }
   bool   match_node_xyz() const { return matchNodeXYZ_; }
   bool   match_elem_ids() const { return matchElemIds_; }
@@ -102,6 +103,7 @@ private:
 
   vector3d offset_;
   double   tolerance_{0.0};
+  int      threadCount_{1};
 
   Omissions blockInclusions_;
   Omissions blockOmissions_;
@@ -9,7 +9,7 @@
 #include "EJ_match_xyz.h"
 
 template <typename INT>
-void match_node_xyz(RegionVector &part_mesh, double tolerance, std::vector<INT> &global_node_map,
-                    std::vector<INT> &local_node_map);
+void match_node_xyz(RegionVector &part_mesh, double tolerance, int threads,
+                    std::vector<INT> &global_node_map, std::vector<INT> &local_node_map);
 
 #endif
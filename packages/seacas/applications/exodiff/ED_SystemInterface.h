@@ -46,6 +46,10 @@ public:
 
   int max_warnings{100};
 
+  int thread_count{1}; // Number of threads used to compare variable values and match entities.
+
+  size_t cache_size{256}; // Megabytes of transient results kept per file for reuse.
+
   std::vector<std::string> glob_var_names{};
   Tolerance                glob_var_default{ToleranceMode::RELATIVE_, 1.0e-6, 0.0};
   std::vector<Tolerance>   glob_var{};
@@ -6,6 +6,7 @@
 #ifndef MINMAXDATA_H
 #define MINMAXDATA_H
 
+#include <cfloat>
 #include <cmath>
 
 enum class ToleranceType {
@@ -70,6 +70,17 @@ public:
     l2_norm_2 += val2 * val2;
   }
 
+  void add_norm(const Norm &other)
+  {
+    l1_norm_d += other.l1_norm_d;
+    l1_norm_1 += other.l1_norm_1;
+    l1_norm_2 += other.l1_norm_2;
+
+    l2_norm_d += other.l2_norm_d;
+    l2_norm_1 += other.l2_norm_1;
+    l2_norm_2 += other.l2_norm_2;
+  }
+
   double l1_norm_1{0.0};
   double l1_norm_2{0.0};
   double l1_norm_d{0.0};
@@ -0,0 +1,39 @@
+// Copyright(C) 1999-2022 National Technology & Engineering Solutions
+// of Sandia, LLC (NTESS).  Under the terms of Contract DE-NA0003525 with
+// NTESS, the U.S. Government retains certain rights in this software.
+//
+// See packages/seacas/LICENSE for details
+#ifndef ED_REDUCTIONS_H
+#define ED_REDUCTIONS_H
+
+#include "MinMaxData.h"
+#include "Norm.h"
+#include "Tolerance.h"
+#include <cstddef>
+
+// Single-pass reductions over contiguous arrays of values.  The
+// tolerance mode is resolved once per call instead of once per value,
+// and each value goes to one of several independent accumulators
+// ("lanes") so that the compiler can vectorize the loops.
+//
+// The relative tolerance modes are not faster this way and use the
+// element-by-element comparison.
+//
+// The location reported with a maximum or minimum is that of the first
+// occurrence, the same as the element-by-element `DiffData::set_max()`
+// and `MinMaxData::spec_min_max()`.  The norms are summed in a different
+// order than element-by-element accumulation, so they may differ from
+// it in the last bits.
+
+// Adds the L1/L2 norms of `v1`, `v2` and `v1 - v2` to `norm`, and the
+// largest `tol.Delta(v1[i], v2[i])` to `max_diff`.  The id stored with
+// the maximum is `id_offset + i`.
+void diff_values(const Tolerance &tol, const double *v1, const double *v2, size_t count,
+                 size_t id_offset, size_t blk, DiffData &max_diff, Norm &norm);
+
+// Updates `mm` with the minimum and maximum absolute value in `vals`.
+// The id stored with each is `id_offset + i`.
+void min_max_values(const double *vals, size_t count, int step, size_t id_offset, size_t blk,
+                    MinMaxData &mm);
+
+#endif
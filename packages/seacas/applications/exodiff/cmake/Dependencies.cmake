@@ -1,3 +1,4 @@
 TRIBITS_PACKAGE_DEFINE_DEPENDENCIES(
   LIB_REQUIRED_PACKAGES SEACASExodus SEACASSuplibC SEACASSuplibCpp
+  LIB_OPTIONAL_TPLS Pthread
 )
@@ -8,6 +8,7 @@
 #define EXOII_READ_H
 
 #include "exo_entity.h"
+#include "result_cache.h"
 
 #include <iostream>
 #include <string>
@@ -142,6 +143,12 @@ public:
   void          Free_Nodal_Results();
   void          Free_Nodal_Results(int var_index);
 
+  // Transient results are read through a bounded cache (see
+  // Result_Cache).  `Set_Next_Step()` tells it which step will be
+  // compared next so that it can be prefetched; 0 means unknown.
+  void                Set_Next_Step(int time_step_num) { cache.Set_Next_Step(time_step_num); }
+  const Result_Cache &Cache() const { return cache; }
+
   // Global data:  (NOTE:  Global and Nodal data are always stored at the same
   //                       time step.  Therefore, if current time step number
   //                       is changed, the results will all be deleted.)
@@ -232,11 +239,14 @@ protected:
   int     num_times{0};
   double *times{nullptr};
 
-  int      cur_time{0};          // Current timestep number of the results (0 means none).
-  double **results{nullptr};     // Array of pointers (to arrays of results data);
-                                 // length is number of nodal variables.
-  double *global_vals{nullptr};  // Array of global variables for the current timestep.
-  double *global_vals2{nullptr}; // Array of global variables used if interpolating.
+  int            cur_time{0};      // Current timestep number of the results (0 means none).
+  const double **results{nullptr}; // Array of pointers (to arrays of results data owned by
+                                   // `cache`); length is number of nodal variables.
+  double *global_vals{nullptr};    // Array of global variables for the current timestep.
+  double *global_vals2{nullptr};   // Array of global variables used if interpolating.
+
+  mutable Result_Cache        cache{};        // Transient results of all entity types.
+  mutable std::vector<double> interpolated{}; // Nodal results if interpolating.
 
   // Internal methods:
 
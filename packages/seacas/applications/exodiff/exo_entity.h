@@ -9,6 +9,7 @@
 
 #include <exodusII.h>
 #include <iostream>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -23,6 +24,7 @@ using EXOTYPE = int;
 #endif
 
 template <typename INT> class ExoII_Read;
+class Result_Cache;
 
 class Exo_Entity
 {
@@ -42,6 +44,9 @@ public:
   int Check_State() const;
 
   void initialize(int file_id, size_t id);
+  // Used when the caller already knows the index of the entity in the
+  // file; avoids reading the id list of all entities of this type.
+  void initialize(int file_id, size_t id, size_t index, Result_Cache *cache);
 
   bool        is_valid_var(size_t var_index) const;
   size_t      var_count() const { return numVars; }
@@ -83,11 +88,21 @@ private:
 
   void get_truth_table() const;
 
-  mutable int *truth_{nullptr};        // Array; holds local truth table for this entity
-  int          currentStep{0};         // Time step number of the current results.
-  int          numVars{0};             // Total number of variables in the file.
-  double     **results_{nullptr};      // Array of pointers (length numVars)
-                                       // to arrays of results (length num_entity).
+  Result_Cache &get_cache();
+  void          release_results(int var_index);
+
+  mutable int *truth_{nullptr}; // Array; holds local truth table for this entity
+  int          currentStep{0};  // Time step number of the current results.
+  int          numVars{0};      // Total number of variables in the file.
+
+  Result_Cache                 *cache_{nullptr}; // Shared with the owning ExoII_Read.
+  std::unique_ptr<Result_Cache> ownCache_{};     // Used if there is no shared cache.
+  std::vector<const double *>   results_{};      // Length numVars; arrays of results
+                                                 // (length num_entity) owned by the cache
+                                                 // or by `interpolated_`.
+  std::vector<int>                 resultSteps_{};  // Step of each pinned cache array; 0 if none.
+  std::vector<std::vector<double>> interpolated_{}; // Interpolated results, if any.
+
   int                   numAttr{0};    // Total number of attributes in the file.
   std::vector<double *> attributes_{}; // Array of pointers (length numAttr)
                                        // to arrays of attributes (length num_entity).
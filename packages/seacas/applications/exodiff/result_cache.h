@@ -0,0 +1,98 @@
+// Copyright(C) 1999-2022 National Technology & Engineering Solutions
+// of Sandia, LLC (NTESS).  Under the terms of Contract DE-NA0003525 with
+// NTESS, the U.S. Government retains certain rights in this software.
+//
+// See packages/seacas/LICENSE for details
+
+#ifndef RESULT_CACHE_H
+#define RESULT_CACHE_H
+
+#include "exo_entity.h" // for EXOTYPE
+
+#include <cstddef>
+#include <future>
+#include <list>
+#include <map>
+#include <tuple>
+#include <vector>
+
+//
+//  Bounded least-recently-used cache of transient variable arrays read
+//  from a single exodus file.  Each array is identified by the entity
+//  type, the entity's index in the file, the variable index and the
+//  time step.
+//
+//  Arrays handed out by `load()` are "pinned" and stay valid until
+//  `release()` is called for them; only unpinned arrays are evicted.
+//  The size limit therefore bounds the data kept for possible reuse
+//  (another step of an interpolation, a prefetched step), not the data
+//  currently being compared.  A limit of zero disables reuse entirely:
+//  arrays are freed as soon as they are released.
+//
+//  If a "next step" has been set and prefetching is enabled, a read of
+//  a variable that was not cached also starts an asynchronous read of
+//  the same variable at the next step.  Prefetching must only be
+//  enabled if the exodus library is thread-safe.
+//
+class Result_Cache
+{
+public:
+  Result_Cache() = default;
+  ~Result_Cache();
+  Result_Cache(const Result_Cache &)                  = delete;
+  const Result_Cache &operator=(const Result_Cache &) = delete;
+
+  void   Set_Limit(size_t bytes);
+  size_t Limit() const { return limit_; }
+  void   Set_Prefetch(bool prefetch) { prefetch_ = prefetch; }
+  void   Set_Next_Step(int step) { nextStep_ = step; }
+
+  // Returns the pinned values of variable `var_index` (0-based) on the
+  // entity `id` of `type` at `time_step`, reading them from `file_id` if
+  // needed.  Sets `status` to the exodus return value; returns nullptr
+  // if the read fails.  Values read with a warning are returned, but are
+  // only reused while they are still pinned.
+  const double *load(int file_id, EXOTYPE type, size_t index, ex_entity_id id, int var_index,
+                     int time_step, size_t count, int *status);
+
+  // Unpins an array returned by `load()`.
+  void release(EXOTYPE type, size_t index, int var_index, int time_step);
+
+  // Waits for any outstanding prefetch reads.  Must be called before
+  // the file is closed.
+  void Wait();
+
+  size_t Hits() const { return hits_; }
+  size_t Misses() const { return misses_; }
+  size_t Peak_Bytes() const { return peakBytes_; }
+
+private:
+  using Key = std::tuple<int, size_t, int, int>; // type, index, var_index, time_step
+
+  struct Entry
+  {
+    Key                     key{};
+    std::vector<double>     values{};
+    int                     pins{0};
+    int                     status{0};
+    std::shared_future<int> pending{};
+  };
+
+  void   prefetch(int file_id, EXOTYPE type, size_t index, ex_entity_id id, int var_index,
+                  int time_step, size_t count);
+  bool   make_room(size_t bytes);
+  void   erase(std::list<Entry>::iterator entry);
+  size_t bytes_of(const Entry &entry) const { return entry.values.size() * sizeof(double); }
+
+  std::list<Entry>                            lru_{}; // Most recently used first.
+  std::map<Key, std::list<Entry>::iterator> entries_{};
+
+  size_t limit_{0};
+  size_t bytes_{0};
+  size_t peakBytes_{0};
+  size_t hits_{0};
+  size_t misses_{0};
+  int    nextStep_{0};
+  bool   prefetch_{false};
+};
+#endif
@@ -0,0 +1,73 @@
+// Copyright(C) 1999-2022 National Technology & Engineering Solutions
+// of Sandia, LLC (NTESS).  Under the terms of Contract DE-NA0003525 with
+// NTESS, the U.S. Government retains certain rights in this software.
+//
+// See packages/seacas/LICENSE for details
+
+#ifndef SPATIAL_INDEX_H
+#define SPATIAL_INDEX_H
+
+#include <cstddef>
+#include <vector>
+
+class Tolerance;
+
+//
+//  k-d tree over a fixed set of points in 1, 2 or 3 dimensions.  Used
+//  to match nodes and element midpoints between two files by position
+//  (-map, -partial) and to find the minimum node separation (-summary).
+//
+//  Points are identified by their 0-based position in the coordinate
+//  arrays passed to the constructor.  Each node splits its points at
+//  the median of the coordinate with the largest extent, so a box
+//  query visits O(log n) nodes plus the points it returns, independent
+//  of how many points share a coordinate value.
+//
+class Spatial_Index
+{
+public:
+  // `y` and `z` are not used (and may be null) if `dim` is less than 2
+  // and 3 respectively.  The coordinates are copied.  The subtrees are
+  // built concurrently if `threads` is greater than 1.
+  Spatial_Index(int dim, const double *x, const double *y, const double *z, size_t count,
+                int threads = 1);
+
+  size_t size() const { return points_.size(); }
+
+  // Appends to `found` every point inside the box [lo, hi], in no
+  // particular order.  `lo` and `hi` have `dim` entries.
+  void search(const double *lo, const double *hi, std::vector<size_t> &found) const;
+
+  // Appends to `found` every point that could match `point` with
+  // `tol.Diff()` false for each coordinate.  This is a superset of the
+  // matches; the caller applies the tolerance to the candidates.
+  void search(const Tolerance &tol, const double *point, std::vector<size_t> &found) const;
+
+  // Smallest distance between any two of the points, or 0.0 if there are
+  // fewer than two.
+  double min_separation(int threads = 1) const;
+
+private:
+  struct Point
+  {
+    double coord[3];
+    size_t id;
+  };
+
+  struct Node
+  {
+    double split{0.0};
+    int    axis{0};
+  };
+
+  void build(size_t node, size_t begin, size_t end, int threads);
+  void search(size_t node, size_t begin, size_t end, const double *lo, const double *hi,
+              std::vector<size_t> &found) const;
+  void nearest(size_t node, size_t begin, size_t end, size_t self, double &best) const;
+
+  int                dim_{0};
+  std::vector<Point> points_{};
+  std::vector<Node>  nodes_{}; // Implicit binary tree; children of `n` are 2n+1 and 2n+2.
+};
+
+#endif
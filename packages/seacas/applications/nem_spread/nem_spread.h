@@ -92,6 +92,10 @@ public:
   int  int64api{0};
   bool force64db{false}; /* Store all ints as 64-bit on output databases. */
 
+  int num_threads{1};   /* Threads used to extract the data for each processor. */
+  int write_threads{1}; /* Threads used to write the parallel files; 1 unless  *
+                         * the Exodus library is thread-safe.                  */
+
   int                    io_ws{0};
   Restart_Description<T> Restart_Info;
   Globals<T, INT>        globals;
@@ -11,7 +11,8 @@
 
 #include "ps_pario_const.h"
 
-double PIO_Time_Array[26]; /* Vector for timings */
+/* Vector for timings; per thread, since each thread writes its own files. */
+thread_local double PIO_Time_Array[26];
 
 struct Parallel_IO PIO_Info;
 
@@ -12,7 +12,7 @@
 #include <string>
 
 /* Global variables. */
-extern double PIO_Time_Array[]; /* Vector for timings */
+extern thread_local double PIO_Time_Array[]; /* Vector for timings */
 
 /*
  * The following variables are used when a single processor is to write
@@ -0,0 +1,52 @@
+/*
+ * Copyright(C) 1999-2022 National Technology & Engineering Solutions
+ * of Sandia, LLC (NTESS).  Under the terms of Contract DE-NA0003525 with
+ * NTESS, the U.S. Government retains certain rights in this software.
+ *
+ * See packages/seacas/LICENSE for details
+ */
+#ifndef PS_THREADS_H
+#define PS_THREADS_H
+
+#include <algorithm> // for min
+#include <atomic>    // for atomic
+#include <thread>    // for thread
+#include <vector>    // for vector
+
+/*
+ * Calls func(iproc) once for each iproc in [begin, end) using up to
+ * `threads` threads, including the calling thread.  Each thread takes
+ * the next processor that has not been started, so a few large
+ * processors do not hold up the others.  With a single thread the
+ * calls are made in order on the calling thread.
+ *
+ * The calls for different processors must not modify the same data.
+ */
+template <typename FUNC> void for_each_proc(int begin, int end, int threads, FUNC func)
+{
+  threads = std::min(threads, end - begin);
+  if (threads <= 1) {
+    for (int iproc = begin; iproc < end; iproc++) {
+      func(iproc);
+    }
+    return;
+  }
+
+  std::atomic<int> next{begin};
+  auto             worker = [&]() {
+    for (int iproc = next++; iproc < end; iproc = next++) {
+      func(iproc);
+    }
+  };
+
+  std::vector<std::thread> workers;
+  for (int i = 1; i < threads; i++) {
+    workers.emplace_back(worker);
+  }
+  worker();
+  for (auto &thread : workers) {
+    thread.join();
+  }
+}
+
+#endif
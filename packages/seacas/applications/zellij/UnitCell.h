@@ -55,6 +55,15 @@ public:
   //! consider neighbors (want all boundaries marked).
   std::vector<int> categorize_nodes(bool neighbor_i, bool neighbor_j, bool all_faces = false) const;
 
+  //! The 0-based position of `node` among the nodes of this unit cell
+  //! that are not shared with a lower neighbor -- the nodes numbered
+  //! by a cell which has the specified neighbors.  Only valid for nodes
+  //! with a `categorize_nodes()` value of 0.
+  int64_t owned_node_ordinal(bool neighbor_i, bool neighbor_j, size_t node) const
+  {
+    return m_ownedNodeOrdinal[(neighbor_i ? 1 : 0) + (neighbor_j ? 2 : 0)][node];
+  }
+
   std::shared_ptr<Ioss::Region> m_region{nullptr};
 
   //!@{ The local node ids of the nodes that are on each face of this
@@ -72,6 +81,12 @@ public:
   std::vector<int64_t> max_J_face{};
   //!@}
 
+  //!@{ For each node of this unit cell, the position of that node in
+  //! the `min_I_face` or `min_J_face` list; -1 if not on the face.
+  std::vector<int64_t> min_I_index{};
+  std::vector<int64_t> min_J_index{};
+  //!@}
+
   ///@{
   //! A pair containing the
   //! minimum and maximum coordinate extent in the `x` and `y`
@@ -99,6 +114,10 @@ public:
   size_t cell_JJ{};
   size_t cell_KK{};
   ///@}
+
+private:
+  //! `owned_node_ordinal()` for each of the four neighbor_i, neighbor_j combinations.
+  std::array<std::vector<int64_t>, 4> m_ownedNodeOrdinal{};
 };
 
 using UnitCellMap = std::map<std::string, std::shared_ptr<UnitCell>>;
@@ -7,11 +7,19 @@
 #include "apr_symrec.h"
 #include "aprepro.h" // for array, Aprepro, etc
 
-#include <vector> // for vector
+#include <algorithm> // for min
+#include <cstddef>   // for size_t
+#include <vector>    // for vector
 
 namespace SEAMS {
   extern SEAMS::Aprepro *aprepro;
 
+  namespace {
+    // Tile edge (in entries) used by the blocked kernels; a 64x64 tile
+    // of doubles is 32 KiB, which fits comfortably in L1/L2.
+    const int block_size = 64;
+  } // namespace
+
   double array_interpolate(const array *arr, double row, double col)
   {
     /*
@@ -82,8 +90,13 @@ namespace SEAMS {
   array *array_add(const array *a, const array *b)
   {
     auto array_data = aprepro->make_array(a->rows, a->cols);
-    for (int i = 0; i < a->rows * a->cols; i++) {
-      array_data->data[i] = a->data[i] + b->data[i];
+
+    size_t        size = (size_t)a->rows * a->cols;
+    const double *ad   = a->data.data();
+    const double *bd   = b->data.data();
+    double       *rd   = array_data->data.data();
+    for (size_t i = 0; i < size; i++) {
+      rd[i] = ad[i] + bd[i];
     }
     return array_data;
   }
@@ -92,8 +105,12 @@ namespace SEAMS {
   {
     auto array_data = aprepro->make_array(a->rows, a->cols);
 
-    for (int i = 0; i < a->rows * a->cols; i++) {
-      array_data->data[i] = a->data[i] - b->data[i];
+    size_t        size = (size_t)a->rows * a->cols;
+    const double *ad   = a->data.data();
+    const double *bd   = b->data.data();
+    double       *rd   = array_data->data.data();
+    for (size_t i = 0; i < size; i++) {
+      rd[i] = ad[i] - bd[i];
     }
     return array_data;
   }
@@ -102,27 +119,73 @@ namespace SEAMS {
   {
     auto array_data = aprepro->make_array(a->rows, a->cols);
 
-    for (int i = 0; i < a->rows * a->cols; i++) {
-      array_data->data[i] = a->data[i] * s;
+    size_t        size = (size_t)a->rows * a->cols;
+    const double *ad   = a->data.data();
+    double       *rd   = array_data->data.data();
+    for (size_t i = 0; i < size; i++) {
+      rd[i] = ad[i] * s;
     }
-
     return array_data;
   }
 
   array *array_mult(const array *a, const array *b)
   {
+    // Blocked i-k-j product.  The innermost loop runs along a row of
+    // both `b` and the result, so it is unit-stride and vectorizes; the
+    // tiles keep the active rows of `b` and of the result in cache.
+    // Each result entry still sums its terms in increasing `k` order
+    // starting from zero, so the values match the simple triple loop.
+    int ar = a->rows;
     int ac = a->cols;
     int bc = b->cols;
 
-    auto array_data = aprepro->make_array(a->rows, b->cols);
+    auto array_data = aprepro->make_array(ar, bc);
+
+    const double *ad = a->data.data();
+    const double *bd = b->data.data();
+    double       *rd = array_data->data.data();
+
+    for (int jj = 0; jj < bc; jj += block_size) {
+      int jend = std::min(jj + block_size, bc);
+      for (int kk = 0; kk < ac; kk += block_size) {
+        int kend = std::min(kk + block_size, ac);
+        for (int i = 0; i < ar; i++) {
+          double       *ri = rd + (size_t)i * bc;
+          const double *ai = ad + (size_t)i * ac;
+          for (int k = kk; k < kend; k++) {
+            double        aik = ai[k];
+            const double *bk  = bd + (size_t)k * bc;
+            for (int j = jj; j < jend; j++) {
+              ri[j] += aik * bk[j];
+            }
+          }
+        }
+      }
+    }
+    return array_data;
+  }
 
-    for (int i = 0; i < b->cols; i++) {
-      for (int j = 0; j < a->rows; j++) {
-        double sum = 0.0;
-        for (int k = 0; k < a->cols; k++) {
-          sum += a->data[j * ac + k] * b->data[k * bc + i];
+  array *array_transpose(const array *a)
+  {
+    // Tiled so that both the reads from `a` and the writes to the
+    // result stay within a few cache lines per tile.
+    int rows = a->rows;
+    int cols = a->cols;
+
+    auto array_data = aprepro->make_array(cols, rows);
+
+    const double *ad = a->data.data();
+    double       *rd = array_data->data.data();
+
+    for (int ii = 0; ii < rows; ii += block_size) {
+      int iend = std::min(ii + block_size, rows);
+      for (int jj = 0; jj < cols; jj += block_size) {
+        int jend = std::min(jj + block_size, cols);
+        for (int i = ii; i < iend; i++) {
+          for (int j = jj; j < jend; j++) {
+            rd[(size_t)j * rows + i] = ad[(size_t)i * cols + j];
+          }
         }
-        array_data->data[j * bc + i] = sum;
       }
     }
     return array_data;
@@ -0,0 +1,108 @@
+// Copyright(C) 1999-2022 National Technology & Engineering Solutions
+// of Sandia, LLC (NTESS).  Under the terms of Contract DE-NA0003525 with
+// NTESS, the U.S. Government retains certain rights in this software.
+//
+// See packages/seacas/LICENSE for details
+
+// Micro-benchmark for the aprepro array kernels.
+//
+// Usage: aprepro_array_bench [size] [repetitions]
+//
+// Times the add, scale, transpose and multiply kernels on square
+// `size` x `size` arrays and checks the transpose and the product
+// against simple loops.  Default size is 1000, default repetitions
+// is 3; a short run is registered as a test.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "apr_array.h"
+#include "apr_symrec.h"
+#include "aprepro.h"
+
+namespace {
+  template <typename FUNC> void time_kernel(const std::string &name, int reps, FUNC func)
+  {
+    double best = 0.0;
+    for (int rep = 0; rep < reps; rep++) {
+      auto start = std::chrono::steady_clock::now();
+      func();
+      auto   end     = std::chrono::steady_clock::now();
+      double elapsed = std::chrono::duration<double>(end - start).count();
+      if (rep == 0 || elapsed < best) {
+        best = elapsed;
+      }
+    }
+    std::cout << std::setw(12) << name << ": " << std::fixed << std::setprecision(6) << best
+              << " seconds (best of " << reps << ")\n";
+  }
+} // namespace
+
+int main(int argc, char *argv[])
+{
+  int size = argc > 1 ? std::atoi(argv[1]) : 1000;
+  int reps = argc > 2 ? std::atoi(argv[2]) : 3;
+  if (size <= 0 || reps <= 0) {
+    std::cerr << "Usage: " << argv[0] << " [size] [repetitions]\n";
+    return EXIT_FAILURE;
+  }
+
+  SEAMS::Aprepro aprepro;
+
+  auto a = aprepro.make_array(size, size);
+  auto b = aprepro.make_array(size, size);
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) {
+      a->data[i * size + j] = std::sin(i + 0.5 * j);
+      b->data[i * size + j] = std::cos(0.5 * i - j);
+    }
+  }
+
+  std::cout << "Array size: " << size << " x " << size << "\n";
+
+  SEAMS::array *sum = nullptr;
+  time_kernel("add", reps, [&]() { sum = SEAMS::array_add(a, b); });
+  time_kernel("scale", reps, [&]() { SEAMS::array_scale(sum, 0.5); });
+  SEAMS::array *trans = nullptr;
+  time_kernel("transpose", reps, [&]() { trans = SEAMS::array_transpose(a); });
+
+  SEAMS::array *prod = nullptr;
+  time_kernel("mult", reps, [&]() { prod = SEAMS::array_mult(a, b); });
+
+  // Reference product using the unblocked i-j-k loop.
+  auto ref = aprepro.make_array(size, size);
+  time_kernel("mult (ref)", 1, [&]() {
+    for (int i = 0; i < size; i++) {
+      for (int j = 0; j < size; j++) {
+        double s = 0.0;
+        for (int k = 0; k < size; k++) {
+          s += a->data[i * size + k] * b->data[k * size + j];
+        }
+        ref->data[i * size + j] = s;
+      }
+    }
+  });
+
+  double max_diff = 0.0;
+  for (size_t i = 0; i < ref->data.size(); i++) {
+    max_diff = std::max(max_diff, std::fabs(ref->data[i] - prod->data[i]));
+  }
+  std::cout << "Max difference from reference product: " << std::scientific << max_diff << "\n";
+
+  bool transposed = true;
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) {
+      transposed = transposed && trans->data[j * size + i] == a->data[i * size + j];
+    }
+  }
+  if (!transposed) {
+    std::cout << "Transpose does not match the input array\n";
+  }
+
+  return transposed && max_diff <= 1.0e-10 * size ? EXIT_SUCCESS : EXIT_FAILURE;
+}
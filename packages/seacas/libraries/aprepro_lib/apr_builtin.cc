@@ -4,6 +4,7 @@
 //
 // See packages/seacas/LICENSE for details
 
+#include "apr_array.h"
 #include "apr_builtin.h"
 #include "apr_symrec.h"
 
@@ -1006,17 +1007,7 @@ namespace SEAMS {
     return array_data;
   }
 
-  array *do_transpose(const array *a)
-  {
-    auto array_data = aprepro->make_array(a->cols, a->rows);
-
-    for (int i = 0; i < a->rows; i++) {
-      for (int j = 0; j < a->cols; j++) {
-        array_data->data[j * a->rows + i] = a->data[i * a->cols + j];
-      }
-    }
-    return array_data;
-  }
+  array *do_transpose(const array *a) { return array_transpose(a); }
 
   array *do_csv_array1(const char *filename) { return do_csv_array(filename, 0.0); }
 
@@ -1016,8 +1016,6 @@ int file_must_exist = 0; /* Global used by include/conditional include */
 /* Global variables used by the looping mechanism */
 SEAMS::file_rec *outer_file = nullptr;
 int              loop_lvl   = 0;
-std::fstream    *tmp_file;
-const char      *temp_f;
 
 #if defined           __NVCC__
 #pragma diag_suppress code_is_unreachable
@@ -1382,8 +1380,7 @@ YY_DECL
             BEGIN(LOOP_SKIP);
           }
           else { /* Value defined and != 0. */
-            temp_f = get_temp_filename();
-            SEAMS::file_rec new_file(temp_f, 0, true, (int)yylval->val);
+            SEAMS::file_rec new_file("_loop_", 0, true, (int)yylval->val);
             if (aprepro.ap_options.debugging)
               std::cerr << "DEBUG LOOP VAR = " << aprepro.ap_file_list.top().loop_count
                         << " in file " << aprepro.ap_file_list.top().name << " at line "
@@ -1392,7 +1389,6 @@ YY_DECL
             outer_file = &aprepro.ap_file_list.top();
             aprepro.ap_file_list.push(new_file);
 
-            tmp_file = new std::fstream(temp_f, std::ios::out);
             loop_lvl++;
             BEGIN(LOOP);
           }
@@ -1425,12 +1421,10 @@ YY_DECL
                           << " in file " << aprepro.ap_file_list.top().name << " at line "
                           << aprepro.ap_file_list.top().lineno - 1 << "\n";
 
-              temp_f = get_temp_filename();
-              SEAMS::file_rec new_file(temp_f, 0, true, (int)s->value.var);
+              SEAMS::file_rec new_file("_loop_", 0, true, (int)s->value.var);
               outer_file = &aprepro.ap_file_list.top();
               aprepro.ap_file_list.push(new_file);
 
-              tmp_file = new std::fstream(temp_f, std::ios::out);
               loop_lvl++;
               BEGIN(LOOP);
             }
@@ -1449,20 +1443,19 @@ YY_DECL
 
           if (loop_lvl == 0) {
             BEGIN(INITIAL);
-            tmp_file->close();
-            delete tmp_file;
 
             if (!aprepro.doLoopSubstitution)
               yy_push_state(VERBATIM);
 
             aprepro.isCollectingLoop = false;
 
-            yyin = aprepro.open_file(aprepro.ap_file_list.top().name, "r");
+            /* Replay the loop body from memory */
+            yyin = new std::istringstream(aprepro.ap_file_list.top().loop_body);
             yyFlexLexer::yypush_buffer_state(yyFlexLexer::yy_create_buffer(yyin, YY_BUF_SIZE));
             curr_index = 0;
           }
           else {
-            (*tmp_file) << yytext;
+            aprepro.ap_file_list.top().loop_body += yytext;
           }
         }
         YY_BREAK
@@ -1471,7 +1464,7 @@ YY_DECL
         YY_RULE_SETUP
         {
           loop_lvl++; /* Nested Loop */
-          (*tmp_file) << yytext;
+          aprepro.ap_file_list.top().loop_body += yytext;
           outer_file->lineno++;
         }
         YY_BREAK
@@ -1482,13 +1475,10 @@ YY_DECL
           if (aprepro.ap_options.interactive || aprepro.string_interactive()) {
             aprepro.warning("Aborting loop(s).", false);
 
-            // Leave the looping state and remove the loop file
+            // Leave the looping state and discard the loop body
             BEGIN(INITIAL);
-            tmp_file->close();
-            delete tmp_file;
 
             if (aprepro.ap_file_list.top().tmp_file) {
-              remove(aprepro.ap_file_list.top().name.c_str());
               aprepro.ap_file_list.pop();
             }
 
@@ -1501,7 +1491,7 @@ YY_DECL
         /* rule 19 can match eol */
         YY_RULE_SETUP
         {
-          (*tmp_file) << yytext;
+          aprepro.ap_file_list.top().loop_body += yytext;
           outer_file->lineno++;
         }
         YY_BREAK
@@ -3294,15 +3284,10 @@ namespace SEAMS {
           std::cerr << "DEBUG LOOP: Loop count = " << aprepro.ap_file_list.top().loop_count << "\n";
         }
         if (--aprepro.ap_file_list.top().loop_count <= 0) {
-          // On Windows, you can't remove the temp file until all the references to the
-          // file object have been released, so we will delete it here.
           delete yyin;
           yyin = nullptr;
 
           if (aprepro.ap_file_list.top().name != "_string_") {
-            if (!aprepro.ap_options.debugging) {
-              remove(aprepro.ap_file_list.top().name.c_str()); /* Delete file if temporary */
-            }
             if (!aprepro.doLoopSubstitution) {
               yy_pop_state();
             }
@@ -3312,11 +3297,11 @@ namespace SEAMS {
           yyFlexLexer::yypop_buffer_state();
         }
         else {
-          // Do not pop ap_file_list; we are rereading that file...
+          // Do not pop ap_file_list; we are replaying the loop body...
           delete yyin;
           yyin = nullptr;
           yyFlexLexer::yypop_buffer_state();
-          yyin = aprepro.open_file(aprepro.ap_file_list.top().name, "r");
+          yyin = new std::istringstream(aprepro.ap_file_list.top().loop_body);
           yyFlexLexer::yypush_buffer_state(yyFlexLexer::yy_create_buffer(yyin, YY_BUF_SIZE));
           aprepro.ap_file_list.top().lineno = 0;
         }
@@ -63,6 +63,7 @@ namespace SEAMS {
     int         lineno{1};
     int         loop_count{0};
     bool        tmp_file{false};
+    std::string loop_body{}; // Contents of a `{loop}` being collected or replayed.
 
     file_rec(const char *my_name, int line_num, bool is_temp, int loop_cnt)
         : name(my_name), lineno(line_num), loop_count(loop_cnt), tmp_file(is_temp)
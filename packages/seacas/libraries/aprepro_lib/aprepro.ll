@@ -45,8 +45,6 @@ int file_must_exist = 0; /* Global used by include/conditional include */
 /* Global variables used by the looping mechanism */
  SEAMS::file_rec *outer_file = nullptr;
 int loop_lvl = 0;
-std::fstream *tmp_file;
-const char  *temp_f;
 
 #if defined __NVCC__
 #pragma diag_suppress code_is_unreachable
@@ -139,8 +137,7 @@ integer {D}+({E})?
       BEGIN(LOOP_SKIP);
     }
     else {/* Value defined and != 0. */
-      temp_f = get_temp_filename();
-      SEAMS::file_rec new_file(temp_f, 0, true, (int)yylval->val);
+      SEAMS::file_rec new_file("_loop_", 0, true, (int)yylval->val);
       if (aprepro.ap_options.debugging)
         std::cerr << "DEBUG LOOP VAR = " << aprepro.ap_file_list.top().loop_count
                   << " in file " << aprepro.ap_file_list.top().name
@@ -149,7 +146,6 @@ integer {D}+({E})?
       outer_file = &aprepro.ap_file_list.top();
       aprepro.ap_file_list.push(new_file);
 
-      tmp_file = new std::fstream(temp_f, std::ios::out);
       loop_lvl++;
       BEGIN(LOOP);
     }
@@ -177,12 +173,10 @@ integer {D}+({E})?
                     << " in file " << aprepro.ap_file_list.top().name
                     << " at line " << aprepro.ap_file_list.top().lineno-1 << "\n";
 
-        temp_f = get_temp_filename();
-        SEAMS::file_rec new_file(temp_f, 0, true, (int)s->value.var);
+        SEAMS::file_rec new_file("_loop_", 0, true, (int)s->value.var);
 	outer_file = &aprepro.ap_file_list.top();
         aprepro.ap_file_list.push(new_file);
 
-        tmp_file = new std::fstream(temp_f, std::ios::out);
         loop_lvl++;
         BEGIN(LOOP);
       }
@@ -199,26 +193,25 @@ integer {D}+({E})?
 
     if (loop_lvl == 0) {
       BEGIN(INITIAL);
-      tmp_file->close();
-      delete tmp_file;
 
       if(!aprepro.doLoopSubstitution)
         yy_push_state(VERBATIM);
 
       aprepro.isCollectingLoop = false;
 
-      yyin = aprepro.open_file(aprepro.ap_file_list.top().name, "r");
+      /* Replay the loop body from memory */
+      yyin = new std::istringstream(aprepro.ap_file_list.top().loop_body);
       yyFlexLexer::yypush_buffer_state (yyFlexLexer::yy_create_buffer( yyin, YY_BUF_SIZE));
       curr_index = 0;
     }
     else {
-      (*tmp_file) << yytext;
+      aprepro.ap_file_list.top().loop_body += yytext;
     }
   }
 
   {WS}"{"[Ll]"oop"{WS}"(".*"\n"  {
     loop_lvl++; /* Nested Loop */
-    (*tmp_file) << yytext;
+    aprepro.ap_file_list.top().loop_body += yytext;
     outer_file->lineno++;
   }
 
@@ -228,13 +221,10 @@ integer {D}+({E})?
     {
       aprepro.warning("Aborting loop(s).", false);
 
-      // Leave the looping state and remove the loop file
+      // Leave the looping state and discard the loop body
       BEGIN(INITIAL);
-      tmp_file->close();
-      delete tmp_file;
 
       if(aprepro.ap_file_list.top().tmp_file) {
-        remove(aprepro.ap_file_list.top().name.c_str());
         aprepro.ap_file_list.pop();
       }
 
@@ -244,7 +234,7 @@ integer {D}+({E})?
   }
 
   .*"\n" {
-    (*tmp_file) << yytext;
+    aprepro.ap_file_list.top().loop_body += yytext;
     outer_file->lineno++;
   }
 }
@@ -823,15 +813,10 @@ integer {D}+({E})?
           std::cerr << "DEBUG LOOP: Loop count = " << aprepro.ap_file_list.top().loop_count << "\n";
         }
         if (--aprepro.ap_file_list.top().loop_count <= 0) {
-          // On Windows, you can't remove the temp file until all the references to the
-          // file object have been released, so we will delete it here.
           delete yyin;
           yyin = nullptr;
 
           if (aprepro.ap_file_list.top().name != "_string_") {
-            if (!aprepro.ap_options.debugging) {
-              remove(aprepro.ap_file_list.top().name.c_str()); /* Delete file if temporary */
-            }
             if (!aprepro.doLoopSubstitution) {
               yy_pop_state();
             }
@@ -841,11 +826,11 @@ integer {D}+({E})?
           yyFlexLexer::yypop_buffer_state();
         }
         else {
-          // Do not pop ap_file_list; we are rereading that file...
+          // Do not pop ap_file_list; we are replaying the loop body...
           delete yyin;
           yyin = nullptr;
           yyFlexLexer::yypop_buffer_state();
-          yyin = aprepro.open_file(aprepro.ap_file_list.top().name, "r");
+          yyin = new std::istringstream(aprepro.ap_file_list.top().loop_body);
           yyFlexLexer::yypush_buffer_state(yyFlexLexer::yy_create_buffer(yyin, YY_BUF_SIZE));
           aprepro.ap_file_list.top().lineno = 0;
         }
@@ -214,6 +214,8 @@ enum ex_inquiry {
   EX_INQ_NUM_ELEM_SET_VAR    = 69, /**< number of element set variables */
   EX_INQ_NUM_SIDE_SET_VAR    = 70, /**< number of sideset variables */
   EX_INQ_NUM_GLOBAL_VAR      = 71, /**< number of global variables */
+  EX_INQ_VARID_CACHE_HITS    = 72, /**< results variable id lookups found in the per-file cache */
+  EX_INQ_VARID_CACHE_MISSES  = 73, /**< results variable id lookups that queried the file */
   EX_INQ_INVALID             = -1
 };
 
@@ -471,6 +473,20 @@ typedef struct ex_var_params
   int *sset_var_tab;
   int *elset_var_tab;
 } ex_var_params;
+
+/*!
+ * Describes one transfer of ex_put_vars() / ex_get_vars(): the values of
+ * variable `var_index` on entity `id` of type `type`.  For #EX_GLOBAL,
+ * `num_entry` consecutive global variables starting at `var_index` are
+ * transferred; for #EX_NODAL, `id` is ignored.
+ */
+typedef struct ex_var
+{
+  ex_entity_type type;
+  int64_t        id;
+  int            var_index;
+  int64_t        num_entry;
+} ex_var;
 /** @} */
 
 #ifndef EXODUS_EXPORT
@@ -619,6 +635,10 @@ EXODUS_EXPORT int ex_put_var(int exoid, int time_step, ex_entity_type var_type,
                              ex_entity_id obj_id, int64_t num_entries_this_obj,
                              const void *var_vals);
 
+/*  Write Several Variables on Several Blocks or Sets at a Time Step */
+EXODUS_EXPORT int ex_put_vars(int exoid, int time_step, size_t var_count, const struct ex_var *vars,
+                              const void *var_vals);
+
 /*  Write Partial Edge Face or Element Variable Values on Blocks or Sets at a Time Step */
 EXODUS_EXPORT int ex_put_partial_var(int exoid, int time_step, ex_entity_type var_type,
                                      int var_index, ex_entity_id obj_id, int64_t start_index,
@@ -633,6 +653,10 @@ EXODUS_EXPORT int ex_put_reduction_vars(int exoid, int time_step, ex_entity_type
 EXODUS_EXPORT int ex_get_var(int exoid, int time_step, ex_entity_type var_type, int var_index,
                              ex_entity_id obj_id, int64_t num_entry_this_obj, void *var_vals);
 
+/*  Read Several Variables Defined On Several Blocks or Sets at a Time Step */
+EXODUS_EXPORT int ex_get_vars(int exoid, int time_step, size_t var_count, const struct ex_var *vars,
+                              void *var_vals);
+
 EXODUS_EXPORT int ex_get_partial_var(int exoid, int time_step, ex_entity_type var_type,
                                      int var_index, ex_entity_id obj_id, int64_t start_index,
                                      int64_t num_entities, void *var_vals);
@@ -105,6 +105,20 @@ EXODUS_EXPORT EX_errval_t *ex_errval;
 
 extern pthread_once_t EX_first_init_g;
 
+/* NOTE: A single library-wide recursive mutex (EX_g) serializes every API
+ * call, even calls on different files.  A per-file lock is not safe here:
+ *  - netCDF-C (and HDF5 unless built thread-safe, in which case it takes
+ *    its own global lock) is not thread-safe, and nearly every API
+ *    function calls into it for its whole duration;
+ *  - `ex_errval` is a single global pointer that is re-pointed at the
+ *    calling thread's error state in EX_FUNC_ENTER;
+ *  - the file item, object stats, and counter lists in ex_conv.c and
+ *    ex_utils.c and the rotating string buffer used by ex__catstr and
+ *    ex__catstr2 are shared by all files.
+ * Applications writing several files concurrently should overlap their
+ * own computation with the exodus calls instead of relying on the library
+ * to run the calls in parallel.
+ */
 typedef struct EX_mutex_struct
 {
   pthread_mutex_t     atomic_lock; /**< lock for atomicity of new mechanism */
@@ -678,6 +692,15 @@ typedef enum ex__element_type ex__element_type;
 
 /* Internal structure declarations */
 
+struct ex__varid_item
+{
+  int grp_id;    /**< group part of the exoid */
+  int obj_type;  /**< ex_entity_type */
+  int obj_index; /**< 1-based index of block/set; 0 marks an empty slot */
+  int var_index; /**< 1-based index of variable */
+  int varid;     /**< netCDF variable id */
+};
+
 struct ex__file_item
 {
   int          file_id;
@@ -695,15 +718,20 @@ struct ex__file_item
   unsigned int shuffle : 1;               /**< 1 true, 0 false */
   unsigned int
       file_type : 2; /**< 0 - classic, 1 -- 64 bit classic, 2 --NetCDF4,  3 --NetCDF4 classic */
-  unsigned int          is_write : 1;    /**< for output or append */
-  unsigned int          is_parallel : 1; /**< 1 true, 0 false */
-  unsigned int          is_hdf5 : 1;     /**< 1 true, 0 false */
-  unsigned int          is_pnetcdf : 1;  /**< 1 true, 0 false */
-  unsigned int          has_nodes : 1;   /**< for input only at this time */
-  unsigned int          has_edges : 1;   /**< for input only at this time */
-  unsigned int          has_faces : 1;   /**< for input only at this time */
-  unsigned int          has_elems : 1;   /**< for input only at this time */
-  struct ex__file_item *next;
+  unsigned int           is_write : 1;       /**< for output or append */
+  unsigned int           is_parallel : 1;    /**< 1 true, 0 false */
+  unsigned int           is_hdf5 : 1;        /**< 1 true, 0 false */
+  unsigned int           is_pnetcdf : 1;     /**< 1 true, 0 false */
+  unsigned int           has_nodes : 1;      /**< for input only at this time */
+  unsigned int           has_edges : 1;      /**< for input only at this time */
+  unsigned int           has_faces : 1;      /**< for input only at this time */
+  unsigned int           has_elems : 1;      /**< for input only at this time */
+  struct ex__varid_item *varid_cache;        /**< results variable varids, by object */
+  size_t                 varid_cache_size;   /**< number of slots in varid_cache (power of 2) */
+  size_t                 varid_cache_count;  /**< number of used slots in varid_cache */
+  size_t                 varid_cache_hits;   /**< lookups satisfied from varid_cache */
+  size_t                 varid_cache_misses; /**< lookups that called nc_inq_varid */
+  struct ex__file_item  *next;
 };
 
 struct ex__elem_blk_parm
@@ -738,6 +766,8 @@ struct ex__obj_stats
 {
   int64_t              *id_vals;
   int                  *stat_vals;
+  size_t               *id_index;      /**< hash of id_vals; 1-based position or 0 if empty slot */
+  size_t                id_index_size; /**< number of slots in id_index (power of 2) */
   size_t                num;
   int                   exoid;
   char                  valid_ids;
@@ -759,6 +789,8 @@ EXODUS_EXPORT char *ex__catstr2(const char * /*string1*/, int /*num1*/, const ch
 EXODUS_EXPORT char *ex__dim_num_entries_in_object(ex_entity_type /*obj_type*/, int /*idx*/);
 EXODUS_EXPORT char *ex__dim_num_objects(ex_entity_type obj_type);
 EXODUS_EXPORT char *ex__name_var_of_object(ex_entity_type /*obj_type*/, int /*i*/, int /*j*/);
+EXODUS_EXPORT int   ex__get_varid_of_object(int exoid, ex_entity_type obj_type, int var_index,
+                                              int obj_index, int *varid);
 EXODUS_EXPORT char *ex__name_red_var_of_object(ex_entity_type /*obj_type*/, int /*indx*/);
 EXODUS_EXPORT char *ex__name_of_map(ex_entity_type /*map_type*/, int /*map_index*/);
 
@@ -796,6 +828,7 @@ struct ex__file_item *ex__add_file_item(int exoid);
 struct ex__obj_stats *ex__get_stat_ptr(int exoid, struct ex__obj_stats **obj_ptr);
 
 EXODUS_EXPORT void ex__rm_stat_ptr(int exoid, struct ex__obj_stats **obj_ptr);
+EXODUS_EXPORT void ex__reset_id_lkup(int exoid, ex_entity_type id_type);
 
 EXODUS_EXPORT void ex__set_compact_storage(int exoid, int varid);
 EXODUS_EXPORT void ex__compress_variable(int exoid, int varid, int type);
@@ -823,6 +856,9 @@ EXODUS_EXPORT int ex__get_partial_nodal_var(int exoid, int time_step, int nodal_
 EXODUS_EXPORT int ex__put_partial_nodal_var(int exoid, int time_step, int nodal_var_index,
                                             int64_t start_node, int64_t num_nodes,
                                             const void *nodal_var_vals);
+EXODUS_EXPORT int ex__put_var_varid(int exoid, ex_entity_type var_type, int var_index,
+                                    ex_entity_id obj_id, int *varid);
+
 EXODUS_EXPORT int ex__get_glob_vars(int exoid, int time_step, int num_glob_vars,
                                     void *glob_var_vals);
 
@@ -250,6 +250,11 @@ int ex__conv_init(int exoid, int *comp_wordsize, int *io_wordsize, int file_word
   new_file->has_faces             = 1;
   new_file->has_elems             = 1;
   new_file->is_write              = is_write;
+  new_file->varid_cache           = NULL;
+  new_file->varid_cache_size      = 0;
+  new_file->varid_cache_count     = 0;
+  new_file->varid_cache_hits      = 0;
+  new_file->varid_cache_misses    = 0;
 
   new_file->next = file_list;
   file_list      = new_file;
@@ -306,6 +311,7 @@ void ex__conv_exit(int exoid)
     file_list = file->next;
   }
 
+  free(file->varid_cache);
   free(file);
   EX_FUNC_VOID();
 }
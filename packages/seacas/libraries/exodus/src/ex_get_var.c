@@ -113,8 +113,8 @@ int ex_get_var(int exoid, int time_step, ex_entity_type var_type, int var_index,
 
   /* inquire previously defined variable */
 
-  if ((status = nc_inq_varid(exoid, ex__name_var_of_object(var_type, var_index, obj_id_ndx),
-                             &varid)) != NC_NOERR) {
+  if ((status = ex__get_varid_of_object(exoid, var_type, var_index, obj_id_ndx, &varid)) !=
+      NC_NOERR) {
     snprintf(errmsg, MAX_ERR_LENGTH, "ERROR: failed to locate %s %" PRId64 " var %d in file id %d",
              ex_name_of_object(var_type), obj_id, var_index, exoid);
     ex_err_fn(exoid, __func__, errmsg, status);
@@ -218,8 +218,7 @@ int ex_get_var_time(int exoid, ex_entity_type var_type, int var_index, int64_t i
   offset = id - (numel - num_entries_this_obj);
 
   /* inquire previously defined variable */
-  if ((status = nc_inq_varid(exoid, ex__name_var_of_object(var_type, var_index, i + 1), &varid)) !=
-      NC_NOERR) {
+  if ((status = ex__get_varid_of_object(exoid, var_type, var_index, i + 1, &varid)) != NC_NOERR) {
     snprintf(errmsg, MAX_ERR_LENGTH,
              "ERROR: failed to locate variable %zu for %dth %s in file id %d", i, var_index,
              ex_name_of_object(var_type), exoid);
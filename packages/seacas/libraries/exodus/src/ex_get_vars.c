@@ -0,0 +1,157 @@
+/*
+ * Copyright(C) 1999-2021 National Technology & Engineering Solutions
+ * of Sandia, LLC (NTESS).  Under the terms of Contract DE-NA0003525 with
+ * NTESS, the U.S. Government retains certain rights in this software.
+ *
+ * See packages/seacas/LICENSE for details
+ */
+
+#include "exodusII.h"     // for ex_err, ex_var, etc
+#include "exodusII_int.h" // for ex__check_valid_file_id, etc
+
+/*!
+\ingroup ResultsData
+
+reads the values of several variables, possibly defined on several
+blocks or sets of different types, for a single time step.  This is
+equivalent to calling ex_get_var() once for each entry of `vars`, but
+the file is checked, the word size is determined, and the library lock
+(in a thread-safe build) is taken only once for the whole batch.  The
+index of a block or set is looked up only once for consecutive entries
+that refer to the same block or set.
+
+The values of all variables are returned in the single contiguous array
+`var_vals`; the values for `vars[i]` immediately follow those for
+`vars[i-1]`.  The array must be float or double to match the compute
+word size passed in ex_create() or ex_open().
+
+\return In case of an error, ex_get_vars() returns a negative number
+and stops at the failing entry.  If an entry refers to a NULL block or
+set, its values are left untouched and a warning (positive number) is
+returned after the remaining entries are read.
+
+\param[in]  exoid      exodus file ID returned from a previous call to ex_create() or ex_open().
+\param[in]  time_step  The time step, as described under ex_put_time(). The first time step is 1.
+\param[in]  var_count  The number of entries in `vars`.
+\param[in]  vars       Array of `var_count` ex_var structures describing the variables.
+\param[out] var_vals   Returned concatenated values of all variables described by `vars`.
+ */
+
+int ex_get_vars(int exoid, int time_step, size_t var_count, const struct ex_var *vars,
+                void *var_vals)
+{
+  int            status;
+  int            varid;
+  int            glob_varid = -1;
+  int            obj_id_ndx = 0;
+  ex_entity_type last_type  = EX_INVALID;
+  int64_t        last_id    = 0;
+  size_t         start[2], count[2];
+  size_t         i;
+  int            ret_val = EX_NOERR;
+  char           errmsg[MAX_ERR_LENGTH];
+
+  if (var_count == 0) {
+    return (EX_NOERR);
+  }
+
+  EX_FUNC_ENTER();
+  if (ex__check_valid_file_id(exoid, __func__) == EX_FATAL) {
+    EX_FUNC_LEAVE(EX_FATAL);
+  }
+
+  int   comp_ws = ex__comp_ws(exoid);
+  char *vals    = (char *)var_vals;
+
+  for (i = 0; i < var_count; i++) {
+    const ex_var *var = &vars[i];
+
+    if (var->num_entry > 0) {
+      if (var->type == EX_NODAL) {
+        status = ex__get_nodal_var(exoid, time_step, var->var_index, var->num_entry, vals);
+        if (status != EX_NOERR) {
+          EX_FUNC_LEAVE(status);
+        }
+      }
+      else {
+        if (var->type == EX_GLOBAL) {
+          if (glob_varid < 0) {
+            if ((status = nc_inq_varid(exoid, VAR_GLO_VAR, &glob_varid)) != NC_NOERR) {
+              snprintf(errmsg, MAX_ERR_LENGTH,
+                       "ERROR: failed to get global variables parameters in file id %d", exoid);
+              ex_err_fn(exoid, __func__, errmsg, status);
+              EX_FUNC_LEAVE(EX_FATAL);
+            }
+          }
+          varid    = glob_varid;
+          start[1] = var->var_index - 1;
+        }
+        else {
+          if (var->type != last_type || var->id != last_id) {
+            /* Determine index of var->id in the id array of this entity type */
+            last_type  = var->type;
+            last_id    = var->id;
+            obj_id_ndx = ex__id_lkup(exoid, var->type, var->id);
+            if (obj_id_ndx <= 0) {
+              ex_get_err(NULL, NULL, &status);
+
+              if (status != 0) {
+                if (status != EX_NULLENTITY) {
+                  snprintf(errmsg, MAX_ERR_LENGTH,
+                           "ERROR: failed to locate %s id %" PRId64 " in id variable in file id %d",
+                           ex_name_of_object(var->type), var->id, exoid);
+                  ex_err_fn(exoid, __func__, errmsg, status);
+                  EX_FUNC_LEAVE(EX_FATAL);
+                }
+                snprintf(errmsg, MAX_ERR_LENGTH,
+                         "Warning: no %s variables for NULL block %" PRId64 " in file id %d",
+                         ex_name_of_object(var->type), var->id, exoid);
+                ex_err_fn(exoid, __func__, errmsg, EX_NULLENTITY);
+                obj_id_ndx = 0;
+              }
+            }
+          }
+
+          if (obj_id_ndx <= 0) {
+            /* NULL block or set; no variables stored */
+            ret_val = EX_WARN;
+            vals += var->num_entry * comp_ws;
+            continue;
+          }
+
+          if ((status = ex__get_varid_of_object(exoid, var->type, var->var_index, obj_id_ndx,
+                                                &varid)) != NC_NOERR) {
+            snprintf(errmsg, MAX_ERR_LENGTH,
+                     "ERROR: failed to locate %s %" PRId64 " var %d in file id %d",
+                     ex_name_of_object(var->type), var->id, var->var_index, exoid);
+            ex_err_fn(exoid, __func__, errmsg, status);
+            EX_FUNC_LEAVE(EX_FATAL);
+          }
+          start[1] = 0;
+        }
+
+        start[0] = time_step - 1;
+        count[0] = 1;
+        count[1] = var->num_entry;
+
+        if (comp_ws == 4) {
+          status = nc_get_vara_float(exoid, varid, start, count, (float *)vals);
+        }
+        else {
+          status = nc_get_vara_double(exoid, varid, start, count, (double *)vals);
+        }
+
+        if (status != NC_NOERR) {
+          snprintf(errmsg, MAX_ERR_LENGTH,
+                   "ERROR: failed to get %s %" PRId64 " variable %d at step %d in file id %d",
+                   ex_name_of_object(var->type), var->id, var->var_index, time_step, exoid);
+          ex_err_fn(exoid, __func__, errmsg, status);
+          EX_FUNC_LEAVE(EX_FATAL);
+        }
+      }
+    }
+    vals += var->num_entry * comp_ws;
+  }
+
+  EX_FUNC_LEAVE(ret_val);
+}
@@ -988,6 +988,22 @@ static int ex_inquire_internal(int exoid, int req_info, int64_t *ret_int, float
 #endif
     break;
 
+  case EX_INQ_VARID_CACHE_HITS:
+  case EX_INQ_VARID_CACHE_MISSES:
+    /* Return the number of results variable id lookups that were satisfied
+     * from (hits) or missed (misses) the per-file varid cache since the
+     * file was opened.
+     */
+    {
+      *ret_int                   = 0;
+      struct ex__file_item *file = ex__find_file_item(exoid);
+      if (file) {
+        *ret_int = req_info == EX_INQ_VARID_CACHE_HITS ? file->varid_cache_hits
+                                                       : file->varid_cache_misses;
+      }
+    }
+    break;
+
   default:
     *ret_int = 0;
     snprintf(errmsg, MAX_ERR_LENGTH, "ERROR: invalid inquiry %d", req_info);
@@ -70,8 +70,8 @@ static int ex__look_up_var(int exoid, ex_entity_type var_type, int var_index, ex
     }
   }
 
-  if ((status = nc_inq_varid(exoid, ex__name_var_of_object(var_type, var_index, obj_id_ndx),
-                             varid)) != NC_NOERR) {
+  if ((status = ex__get_varid_of_object(exoid, var_type, var_index, obj_id_ndx, varid)) !=
+      NC_NOERR) {
     if (status == NC_ENOTVAR) { /* variable doesn't exist, create it! */
       /* check for the existence of an TNAME variable truth table */
       if (nc_inq_varid(exoid, VOBJTAB, varid) == NC_NOERR) {
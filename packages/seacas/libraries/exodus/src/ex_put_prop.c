@@ -328,6 +328,11 @@ int ex_put_prop(int exoid, ex_entity_type obj_type, ex_entity_id obj_id, const c
     EX_FUNC_LEAVE(EX_FATAL);
   }
 
+  /* the cached ids used by ex__id_lkup are now stale */
+  if (strcmp("ID", prop_name) == 0) {
+    ex__reset_id_lkup(exoid, obj_type);
+  }
+
   EX_FUNC_LEAVE(EX_NOERR);
 
 /* Fatal error: exit definition mode and return */
@@ -70,9 +70,21 @@ static int ex__look_up_var(int exoid, ex_entity_type var_type, int var_index, ex
     }
   }
 
-  if ((status = nc_inq_varid(exoid, ex__name_var_of_object(var_type, var_index, obj_id_ndx),
-                             varid)) != NC_NOERR) {
+  if ((status = ex__get_varid_of_object(exoid, var_type, var_index, obj_id_ndx, varid)) !=
+      NC_NOERR) {
     if (status == NC_ENOTVAR) { /* variable doesn't exist, create it! */
+      /* make sure that the variable index is valid before defining anything */
+      if (var_index < 1 || (nc_inq_dimid(exoid, DNUMOBJVAR, &dimid) == NC_NOERR &&
+                            nc_inq_dimlen(exoid, dimid, &num_obj_var) == NC_NOERR &&
+                            (size_t)var_index > num_obj_var)) {
+        snprintf(errmsg, MAX_ERR_LENGTH,
+                 "ERROR: Invalid %s variable index %d for %s %" PRId64 " in file id %d",
+                 ex_name_of_object(var_type), var_index, ex_name_of_object(var_type), obj_id,
+                 exoid);
+        ex_err_fn(exoid, __func__, errmsg, EX_BADPARAM);
+        return (EX_FATAL);
+      }
+
       /* check for the existence of an TNAME variable truth table */
       if (nc_inq_varid(exoid, VOBJTAB, varid) == NC_NOERR) {
         /* find out number of TNAMEs and TNAME variables */
@@ -166,6 +178,68 @@ error_ret:
   return (EX_FATAL);
 }
 
+/*! \internal
+ * Returns in `varid` the netCDF variable id of the `var_index`-th variable of
+ * the block/set `obj_id` of type `var_type`, defining the variable if it does
+ * not exist yet.  Used by ex_put_var() and ex_put_vars(); not valid for
+ * #EX_GLOBAL or #EX_NODAL variables.
+ */
+int ex__put_var_varid(int exoid, ex_entity_type var_type, int var_index, ex_entity_id obj_id,
+                      int *varid)
+{
+  int  status;
+  char errmsg[MAX_ERR_LENGTH];
+
+  switch (var_type) {
+  case EX_ASSEMBLY:
+    status = ex__look_up_var(exoid, var_type, var_index, obj_id, "", VAR_ASSEMBLY_TAB,
+                             DIM_NUM_ASSEMBLY, DIM_NUM_ASSEMBLY_VAR, varid);
+    break;
+  case EX_BLOB:
+    status = ex__look_up_var(exoid, var_type, var_index, obj_id, "", VAR_BLOB_TAB, DIM_NUM_BLOB,
+                             DIM_NUM_BLOB_VAR, varid);
+    break;
+  case EX_EDGE_BLOCK:
+    status = ex__look_up_var(exoid, var_type, var_index, obj_id, VAR_ID_ED_BLK, VAR_EBLK_TAB,
+                             DIM_NUM_ED_BLK, DIM_NUM_EDG_VAR, varid);
+    break;
+  case EX_FACE_BLOCK:
+    status = ex__look_up_var(exoid, var_type, var_index, obj_id, VAR_ID_FA_BLK, VAR_FBLK_TAB,
+                             DIM_NUM_FA_BLK, DIM_NUM_FAC_VAR, varid);
+    break;
+  case EX_ELEM_BLOCK:
+    status = ex__look_up_var(exoid, var_type, var_index, obj_id, VAR_ID_EL_BLK, VAR_ELEM_TAB,
+                             DIM_NUM_EL_BLK, DIM_NUM_ELE_VAR, varid);
+    break;
+  case EX_NODE_SET:
+    status = ex__look_up_var(exoid, var_type, var_index, obj_id, VAR_NS_IDS, VAR_NSET_TAB,
+                             DIM_NUM_NS, DIM_NUM_NSET_VAR, varid);
+    break;
+  case EX_EDGE_SET:
+    status = ex__look_up_var(exoid, var_type, var_index, obj_id, VAR_ES_IDS, VAR_ESET_TAB,
+                             DIM_NUM_ES, DIM_NUM_ESET_VAR, varid);
+    break;
+  case EX_FACE_SET:
+    status = ex__look_up_var(exoid, var_type, var_index, obj_id, VAR_FS_IDS, VAR_FSET_TAB,
+                             DIM_NUM_FS, DIM_NUM_FSET_VAR, varid);
+    break;
+  case EX_SIDE_SET:
+    status = ex__look_up_var(exoid, var_type, var_index, obj_id, VAR_SS_IDS, VAR_SSET_TAB,
+                             DIM_NUM_SS, DIM_NUM_SSET_VAR, varid);
+    break;
+  case EX_ELEM_SET:
+    status = ex__look_up_var(exoid, var_type, var_index, obj_id, VAR_ELS_IDS, VAR_ELSET_TAB,
+                             DIM_NUM_ELS, DIM_NUM_ELSET_VAR, varid);
+    break;
+  default:
+    snprintf(errmsg, MAX_ERR_LENGTH, "ERROR: invalid variable type (%d) specified for file id %d",
+             var_type, exoid);
+    ex_err_fn(exoid, __func__, errmsg, EX_BADPARAM);
+    return (EX_FATAL);
+  }
+  return (status);
+}
+
 /*!
 \ingroup ResultsData
 writes the values of a single variable of the specified type for a
@@ -273,51 +347,9 @@ int ex_put_var(int exoid, int time_step, ex_entity_type var_type, int var_index,
     status = ex__put_nodal_var(exoid, time_step, var_index, num_entries_this_obj, var_vals);
     EX_FUNC_LEAVE(status);
     break;
-  case EX_ASSEMBLY:
-    status = ex__look_up_var(exoid, var_type, var_index, obj_id, "", VAR_ASSEMBLY_TAB,
-                             DIM_NUM_ASSEMBLY, DIM_NUM_ASSEMBLY_VAR, &varid);
-    break;
-  case EX_BLOB:
-    status = ex__look_up_var(exoid, var_type, var_index, obj_id, "", VAR_BLOB_TAB, DIM_NUM_BLOB,
-                             DIM_NUM_BLOB_VAR, &varid);
-    break;
-  case EX_EDGE_BLOCK:
-    status = ex__look_up_var(exoid, var_type, var_index, obj_id, VAR_ID_ED_BLK, VAR_EBLK_TAB,
-                             DIM_NUM_ED_BLK, DIM_NUM_EDG_VAR, &varid);
-    break;
-  case EX_FACE_BLOCK:
-    status = ex__look_up_var(exoid, var_type, var_index, obj_id, VAR_ID_FA_BLK, VAR_FBLK_TAB,
-                             DIM_NUM_FA_BLK, DIM_NUM_FAC_VAR, &varid);
-    break;
-  case EX_ELEM_BLOCK:
-    status = ex__look_up_var(exoid, var_type, var_index, obj_id, VAR_ID_EL_BLK, VAR_ELEM_TAB,
-                             DIM_NUM_EL_BLK, DIM_NUM_ELE_VAR, &varid);
-    break;
-  case EX_NODE_SET:
-    status = ex__look_up_var(exoid, var_type, var_index, obj_id, VAR_NS_IDS, VAR_NSET_TAB,
-                             DIM_NUM_NS, DIM_NUM_NSET_VAR, &varid);
-    break;
-  case EX_EDGE_SET:
-    status = ex__look_up_var(exoid, var_type, var_index, obj_id, VAR_ES_IDS, VAR_ESET_TAB,
-                             DIM_NUM_ES, DIM_NUM_ESET_VAR, &varid);
-    break;
-  case EX_FACE_SET:
-    status = ex__look_up_var(exoid, var_type, var_index, obj_id, VAR_FS_IDS, VAR_FSET_TAB,
-                             DIM_NUM_FS, DIM_NUM_FSET_VAR, &varid);
-    break;
-  case EX_SIDE_SET:
-    status = ex__look_up_var(exoid, var_type, var_index, obj_id, VAR_SS_IDS, VAR_SSET_TAB,
-                             DIM_NUM_SS, DIM_NUM_SSET_VAR, &varid);
-    break;
-  case EX_ELEM_SET:
-    status = ex__look_up_var(exoid, var_type, var_index, obj_id, VAR_ELS_IDS, VAR_ELSET_TAB,
-                             DIM_NUM_ELS, DIM_NUM_ELSET_VAR, &varid);
-    break;
   default:
-    snprintf(errmsg, MAX_ERR_LENGTH, "ERROR: invalid variable type (%d) specified for file id %d",
-             var_type, exoid);
-    ex_err_fn(exoid, __func__, errmsg, EX_BADPARAM);
-    EX_FUNC_LEAVE(EX_FATAL);
+    status = ex__put_var_varid(exoid, var_type, var_index, obj_id, &varid);
+    break;
   }
 
   if (status != EX_NOERR) {
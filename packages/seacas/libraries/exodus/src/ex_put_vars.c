@@ -0,0 +1,135 @@
+/*
+ * Copyright(C) 1999-2021 National Technology & Engineering Solutions
+ * of Sandia, LLC (NTESS).  Under the terms of Contract DE-NA0003525 with
+ * NTESS, the U.S. Government retains certain rights in this software.
+ *
+ * See packages/seacas/LICENSE for details
+ */
+
+#include "exodusII.h"     // for ex_err, ex_var, etc
+#include "exodusII_int.h" // for EX_FATAL, ex__put_var_varid, etc
+
+/*!
+\ingroup ResultsData
+
+writes the values of several variables, possibly on several blocks or
+sets of different types, for a single time step.  This is equivalent to
+calling ex_put_var() once for each entry of `vars`, but the file is
+checked, the word size is determined, and the library lock (in a
+thread-safe build) is taken only once for the whole batch.
+
+The values of all variables are passed in the single contiguous array
+`var_vals`; the values for `vars[i]` immediately follow those for
+`vars[i-1]`.  The array must be float or double to match the compute
+word size passed in ex_create() or ex_open().
+
+\return In case of an error, ex_put_vars() returns a negative number
+and stops at the failing entry; entries before it have been written.
+If an entry refers to a NULL block or set, it is skipped and a warning
+(positive number) is returned after the remaining entries are written.
+
+\param[in] exoid      exodus file ID returned from a previous call to ex_create() or ex_open().
+\param[in] time_step  The time step number, as described under ex_put_time(). The first time step
+                      is 1.
+\param[in] var_count  The number of entries in `vars`.
+\param[in] vars       Array of `var_count` ex_var structures describing the variables.
+\param[in] var_vals   Concatenated values of all variables described by `vars`.
+
+For example, the following writes element variables 1 and 2 on element
+block 10 (20 elements) and element variable 1 on element block 11 (5
+elements):
+
+~~~{.c}
+ex_var vars[3] = {{EX_ELEM_BLOCK, 10, 1, 20},
+                  {EX_ELEM_BLOCK, 10, 2, 20},
+                  {EX_ELEM_BLOCK, 11, 1, 5}};
+double vals[45];
+\comment{application code fills in vals}
+error = ex_put_vars(exoid, time_step, 3, vars, vals);
+~~~
+ */
+
+int ex_put_vars(int exoid, int time_step, size_t var_count, const struct ex_var *vars,
+                const void *var_vals)
+{
+  int    varid;
+  int    glob_varid = -1;
+  size_t start[2], count[2];
+  size_t i;
+  int    status;
+  int    ret_val = EX_NOERR;
+  char   errmsg[MAX_ERR_LENGTH];
+
+  if (var_count == 0) {
+    return (EX_NOERR);
+  }
+
+  EX_FUNC_ENTER();
+  if (ex__check_valid_file_id(exoid, __func__) == EX_FATAL) {
+    EX_FUNC_LEAVE(EX_FATAL);
+  }
+
+  int         comp_ws = ex__comp_ws(exoid);
+  const char *vals    = (const char *)var_vals;
+
+  for (i = 0; i < var_count; i++) {
+    const ex_var *var = &vars[i];
+
+    if (var->num_entry > 0) {
+      if (var->type == EX_NODAL) {
+        status = ex__put_nodal_var(exoid, time_step, var->var_index, var->num_entry, vals);
+        if (status != EX_NOERR) {
+          EX_FUNC_LEAVE(status);
+        }
+      }
+      else {
+        if (var->type == EX_GLOBAL) {
+          if (glob_varid < 0) {
+            if ((status = nc_inq_varid(exoid, VAR_GLO_VAR, &glob_varid)) != NC_NOERR) {
+              snprintf(errmsg, MAX_ERR_LENGTH, "ERROR: no global variables defined in file id %d",
+                       exoid);
+              ex_err_fn(exoid, __func__, errmsg, status);
+              EX_FUNC_LEAVE(EX_FATAL);
+            }
+          }
+          varid    = glob_varid;
+          start[1] = var->var_index - 1;
+        }
+        else {
+          status = ex__put_var_varid(exoid, var->type, var->var_index, var->id, &varid);
+          if (status == EX_WARN) {
+            ret_val = EX_WARN;
+            vals += var->num_entry * comp_ws;
+            continue;
+          }
+          if (status != EX_NOERR) {
+            EX_FUNC_LEAVE(status);
+          }
+          start[1] = 0;
+        }
+
+        start[0] = time_step - 1;
+        count[0] = 1;
+        count[1] = var->num_entry;
+
+        if (comp_ws == 4) {
+          status = nc_put_vara_float(exoid, varid, start, count, (const float *)vals);
+        }
+        else {
+          status = nc_put_vara_double(exoid, varid, start, count, (const double *)vals);
+        }
+
+        if (status != NC_NOERR) {
+          snprintf(errmsg, MAX_ERR_LENGTH,
+                   "ERROR: failed to store %s %" PRId64 " variable %d at step %d in file id %d",
+                   ex_name_of_object(var->type), var->id, var->var_index, time_step, exoid);
+          ex_err_fn(exoid, __func__, errmsg, status);
+          EX_FUNC_LEAVE(EX_FATAL);
+        }
+      }
+    }
+    vals += var->num_entry * comp_ws;
+  }
+
+  EX_FUNC_LEAVE(ret_val);
+}
@@ -695,6 +695,90 @@ char *ex__name_var_of_object(ex_entity_type obj_type, int i, int j)
   }
 }
 
+static size_t ex__varid_hash(int grp_id, int obj_type, int obj_index, int var_index)
+{
+  uint64_t h = ((uint64_t)(unsigned)obj_index << 32) ^ (uint64_t)(unsigned)var_index;
+  h ^= ((uint64_t)(unsigned)obj_type << 56) ^ ((uint64_t)(unsigned)grp_id << 40);
+  h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+  return (size_t)(h ^ (h >> 31));
+}
+
+static void ex__varid_cache_insert(struct ex__file_item *file, const struct ex__varid_item *item)
+{
+  /* Keep load factor at or below 1/2; if the table cannot grow, just don't cache */
+  if (2 * (file->varid_cache_count + 1) > file->varid_cache_size) {
+    size_t                 new_size  = file->varid_cache_size > 0 ? 2 * file->varid_cache_size : 64;
+    struct ex__varid_item *new_cache = calloc(new_size, sizeof(struct ex__varid_item));
+    if (new_cache == NULL) {
+      return;
+    }
+    for (size_t i = 0; i < file->varid_cache_size; i++) {
+      const struct ex__varid_item *old = &file->varid_cache[i];
+      if (old->obj_index != 0) {
+        size_t h = ex__varid_hash(old->grp_id, old->obj_type, old->obj_index, old->var_index) &
+                   (new_size - 1);
+        while (new_cache[h].obj_index != 0) {
+          h = (h + 1) & (new_size - 1);
+        }
+        new_cache[h] = *old;
+      }
+    }
+    free(file->varid_cache);
+    file->varid_cache      = new_cache;
+    file->varid_cache_size = new_size;
+  }
+
+  size_t mask = file->varid_cache_size - 1;
+  size_t h =
+      ex__varid_hash(item->grp_id, item->obj_type, item->obj_index, item->var_index) & mask;
+  while (file->varid_cache[h].obj_index != 0) {
+    h = (h + 1) & mask;
+  }
+  file->varid_cache[h] = *item;
+  file->varid_cache_count++;
+}
+
+/*!
+  \internal
+  Returns in `varid` the netCDF variable id of the `var_index`-th results
+  variable on the `obj_index`-th (1-based) block or set of type `obj_type`;
+  this is the variable named by ex__name_var_of_object().  The ids found are
+  cached per open file so that later calls do not need to build the variable
+  name and call nc_inq_varid(). Returns the netCDF status of the lookup.
+ */
+int ex__get_varid_of_object(int exoid, ex_entity_type obj_type, int var_index, int obj_index,
+                            int *varid)
+{
+  struct ex__file_item *file   = ex__find_file_item(exoid);
+  int                   grp_id = (unsigned)exoid & EX_GRP_ID_MASK;
+
+  if (file != NULL && file->varid_cache != NULL && obj_index > 0) {
+    size_t mask = file->varid_cache_size - 1;
+    size_t h    = ex__varid_hash(grp_id, obj_type, obj_index, var_index) & mask;
+    while (file->varid_cache[h].obj_index != 0) {
+      const struct ex__varid_item *item = &file->varid_cache[h];
+      if (item->obj_index == obj_index && item->var_index == var_index &&
+          item->obj_type == (int)obj_type && item->grp_id == grp_id) {
+        file->varid_cache_hits++;
+        *varid = item->varid;
+        return NC_NOERR;
+      }
+      h = (h + 1) & mask;
+    }
+  }
+
+  int status = nc_inq_varid(exoid, ex__name_var_of_object(obj_type, var_index, obj_index), varid);
+  if (file != NULL) {
+    file->varid_cache_misses++;
+    if (status == NC_NOERR && obj_index > 0) {
+      struct ex__varid_item item = {grp_id, obj_type, obj_index, var_index, *varid};
+      ex__varid_cache_insert(file, &item);
+    }
+  }
+  return status;
+}
+
 /*!
   \internal
   \undoc
@@ -737,6 +821,69 @@ char *ex__name_of_map(ex_entity_type map_type, int map_index)
   }
 }
 
+/* Id arrays with at most this many entries are searched linearly; larger
+ * arrays get a hash index built the first time they are searched. */
+#define EX_ID_INDEX_MIN 16
+
+static uint64_t ex__id_hash(int64_t id)
+{
+  /* 64-bit finalizer from splitmix64 */
+  uint64_t h = (uint64_t)id;
+  h          = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  h          = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+  return h ^ (h >> 31);
+}
+
+/*! Build an open-addressing hash index (id -> position) over the cached id
+ * array. If the same id appears more than once, the first position is kept
+ * to match the result of a linear search. If the allocation fails, the index
+ * is left empty and lookups fall back to a linear search.
+ * \internal
+ */
+static void ex__build_id_index(struct ex__obj_stats *stats)
+{
+  size_t size = 2 * EX_ID_INDEX_MIN;
+  while (size < 2 * stats->num) {
+    size <<= 1;
+  }
+
+  size_t *index = calloc(size, sizeof(size_t));
+  if (index == NULL) {
+    return;
+  }
+
+  size_t mask = size - 1;
+  for (size_t i = 0; i < stats->num; i++) {
+    size_t h = ex__id_hash(stats->id_vals[i]) & mask;
+    while (index[h] != 0 && stats->id_vals[index[h] - 1] != stats->id_vals[i]) {
+      h = (h + 1) & mask;
+    }
+    if (index[h] == 0) {
+      index[h] = i + 1;
+    }
+  }
+  stats->id_index      = index;
+  stats->id_index_size = size;
+}
+
+/*! Return the 0-based position of `id` in the cached id array, or
+ * `stats->num` if it is not present.
+ * \internal
+ */
+static size_t ex__find_id_index(const struct ex__obj_stats *stats, int64_t id)
+{
+  size_t mask = stats->id_index_size - 1;
+  size_t h    = ex__id_hash(id) & mask;
+  while (stats->id_index[h] != 0) {
+    size_t pos = stats->id_index[h] - 1;
+    if (stats->id_vals[pos] == id) {
+      return pos;
+    }
+    h = (h + 1) & mask;
+  }
+  return stats->num;
+}
+
 /*****************************************************************************
 *
 * ex__id_lkup - look up id
@@ -960,11 +1107,20 @@ int ex__id_lkup(int exoid, ex_entity_type id_type, ex_entity_id num)
     i = num - 1;
   }
   else {
-    /* Do a linear search through the id array to find the array value
-       corresponding to the passed index number */
-    for (i = 0; i < dim_len; i++) {
-      if (id_vals[i] == num) {
-        break; /* found the id requested */
+    if (tmp_stats->valid_ids && tmp_stats->id_index == NULL && dim_len > EX_ID_INDEX_MIN) {
+      ex__build_id_index(tmp_stats);
+    }
+
+    if (tmp_stats->valid_ids && tmp_stats->id_index != NULL) {
+      i = ex__find_id_index(tmp_stats, num);
+    }
+    else {
+      /* Do a linear search through the id array to find the array value
+         corresponding to the passed index number */
+      for (i = 0; i < dim_len; i++) {
+        if (id_vals[i] == num) {
+          break; /* found the id requested */
+        }
       }
     }
   }
@@ -1066,12 +1222,14 @@ struct ex__obj_stats *ex__get_stat_ptr(int exoid, struct ex__obj_stats **obj_ptr
     tmp_ptr             = (struct ex__obj_stats *)calloc(1, sizeof(struct ex__obj_stats));
     tmp_ptr->exoid      = exoid;
     tmp_ptr->next       = *obj_ptr;
-    tmp_ptr->id_vals    = 0;
-    tmp_ptr->stat_vals  = 0;
-    tmp_ptr->num        = 0;
-    tmp_ptr->valid_ids  = 0;
-    tmp_ptr->valid_stat = 0;
-    *obj_ptr            = tmp_ptr;
+    tmp_ptr->id_vals       = 0;
+    tmp_ptr->stat_vals     = 0;
+    tmp_ptr->id_index      = 0;
+    tmp_ptr->id_index_size = 0;
+    tmp_ptr->num           = 0;
+    tmp_ptr->valid_ids     = 0;
+    tmp_ptr->valid_stat    = 0;
+    *obj_ptr               = tmp_ptr;
   }
   return tmp_ptr;
 }
@@ -1106,6 +1264,7 @@ void ex__rm_stat_ptr(int exoid, struct ex__obj_stats **obj_ptr)
       }
       free(tmp_ptr->id_vals); /* free up memory */
       free(tmp_ptr->stat_vals);
+      free(tmp_ptr->id_index);
       free(tmp_ptr);
       break; /* Quit if found */
     }
@@ -1114,6 +1273,58 @@ void ex__rm_stat_ptr(int exoid, struct ex__obj_stats **obj_ptr)
   }
 }
 
+/******************************************************************************
+ *
+ * ex__reset_id_lkup - discard the cached ids of an object type
+ *
+ *****************************************************************************/
+
+/*! this routine discards the cached id and status arrays and the id hash
+ * index used by ex__id_lkup for the specified object type and exoid; it
+ * must be called whenever the ids stored in the file are modified after
+ * they have been cached so that the next lookup rereads them.
+ * \internal
+ */
+
+void ex__reset_id_lkup(int exoid, ex_entity_type id_type)
+{
+  struct ex__obj_stats *tmp_ptr = NULL;
+
+  switch (id_type) {
+  case EX_ELEM_BLOCK: tmp_ptr = exoII_eb; break;
+  case EX_NODE_SET: tmp_ptr = exoII_ns; break;
+  case EX_SIDE_SET: tmp_ptr = exoII_ss; break;
+  case EX_EDGE_BLOCK: tmp_ptr = exoII_ed; break;
+  case EX_FACE_BLOCK: tmp_ptr = exoII_fa; break;
+  case EX_EDGE_SET: tmp_ptr = exoII_es; break;
+  case EX_FACE_SET: tmp_ptr = exoII_fs; break;
+  case EX_ELEM_SET: tmp_ptr = exoII_els; break;
+  case EX_NODE_MAP: tmp_ptr = exoII_nm; break;
+  case EX_EDGE_MAP: tmp_ptr = exoII_edm; break;
+  case EX_FACE_MAP: tmp_ptr = exoII_fam; break;
+  case EX_ELEM_MAP: tmp_ptr = exoII_em; break;
+  default: return;
+  }
+
+  while (tmp_ptr) {
+    if (tmp_ptr->exoid == exoid) {
+      free(tmp_ptr->id_vals);
+      free(tmp_ptr->stat_vals);
+      free(tmp_ptr->id_index);
+      tmp_ptr->id_vals       = NULL;
+      tmp_ptr->stat_vals     = NULL;
+      tmp_ptr->id_index      = NULL;
+      tmp_ptr->id_index_size = 0;
+      tmp_ptr->num           = 0;
+      tmp_ptr->valid_ids     = false;
+      tmp_ptr->valid_stat    = false;
+      tmp_ptr->sequential    = false;
+      break;
+    }
+    tmp_ptr = tmp_ptr->next;
+  }
+}
+
 /* structures to hold number of blocks of that type for each file id */
 static struct ex__list_item *ed_ctr_list = NULL; /* edge blocks */
 static struct ex__list_item *fa_ctr_list = NULL; /* face blocks */
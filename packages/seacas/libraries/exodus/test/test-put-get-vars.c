@@ -0,0 +1,161 @@
+/*
+ * Copyright(C) 1999-2022 National Technology & Engineering Solutions
+ * of Sandia, LLC (NTESS).  Under the terms of Contract DE-NA0003525 with
+ * NTESS, the U.S. Government retains certain rights in this software.
+ *
+ * See packages/seacas/LICENSE for details
+ */
+/*****************************************************************************
+ *
+ * test-put-get-vars - write several variables at a time with ex_put_vars,
+ *                     read them back with ex_get_vars and ex_get_var and
+ *                     compare; check that an invalid variable index or an
+ *                     unknown block/set id is reported as an error.
+ *
+ *****************************************************************************/
+
+#include "exodusII.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define STRINGIFY(x) #x
+#define TOSTRING(x)  STRINGIFY(x)
+
+#define EXCHECK(funcall)                                                                           \
+  do {                                                                                             \
+    int error = (funcall);                                                                         \
+    printf("after %s, error = %d\n", TOSTRING(funcall), error);                                    \
+    if (error != EX_NOERR) {                                                                       \
+      fprintf(stderr, "Error calling %s\n", TOSTRING(funcall));                                    \
+      ex_close(exoid);                                                                             \
+      exit(-1);                                                                                    \
+    }                                                                                              \
+  } while (0)
+
+#define NUM_VARS 8
+#define NUM_VALS 27
+#define NUM_STEP 2
+
+static const ex_var vars[NUM_VARS] = {
+    {EX_GLOBAL, 0, 1, 2},      {EX_NODAL, 0, 1, 8},       {EX_NODAL, 0, 2, 8},
+    {EX_ELEM_BLOCK, 10, 1, 2}, {EX_ELEM_BLOCK, 10, 2, 2}, {EX_ELEM_BLOCK, 11, 1, 1},
+    {EX_ELEM_BLOCK, 11, 2, 1}, {EX_NODE_SET, 20, 1, 3}};
+
+static void fill_values(int step, double *vals)
+{
+  int n = 0;
+  for (int i = 0; i < NUM_VARS; i++) {
+    for (int k = 0; k < vars[i].num_entry; k++) {
+      vals[n++] = step * 1000.0 + i * 100.0 + k;
+    }
+  }
+}
+
+static int compare_values(const char *what, int step, const double *expected, const double *vals)
+{
+  int errors = 0;
+  for (int n = 0; n < NUM_VALS; n++) {
+    if (vals[n] != expected[n]) {
+      fprintf(stderr, "%s: step %d, value %d is %g, expected %g\n", what, step, n, vals[n],
+              expected[n]);
+      errors++;
+    }
+  }
+  return errors;
+}
+
+int main(int argc, char **argv)
+{
+  ex_opts(EX_VERBOSE);
+
+  /* Create a 2D mesh with two element blocks and one node set */
+  int CPU_word_size = 8;
+  int IO_word_size  = 8;
+  int exoid         = ex_create("test-vars.exo", EX_CLOBBER, &CPU_word_size, &IO_word_size);
+  printf("after ex_create for test-vars.exo, exoid = %d\n", exoid);
+  if (exoid < 0) {
+    exit(-1);
+  }
+
+  EXCHECK(ex_put_init(exoid, "ex_put_vars / ex_get_vars test", 2, 8, 3, 2, 1, 0));
+
+  double x[] = {0.0, 1.0, 2.0, 3.0, 0.0, 1.0, 2.0, 3.0};
+  double y[] = {0.0, 0.0, 0.0, 0.0, 1.0, 1.0, 1.0, 1.0};
+  EXCHECK(ex_put_coord(exoid, x, y, NULL));
+
+  int conn10[] = {1, 2, 6, 5, 2, 3, 7, 6};
+  int conn11[] = {3, 4, 8, 7};
+  EXCHECK(ex_put_block(exoid, EX_ELEM_BLOCK, 10, "QUAD4", 2, 4, 0, 0, 0));
+  EXCHECK(ex_put_block(exoid, EX_ELEM_BLOCK, 11, "QUAD4", 1, 4, 0, 0, 0));
+  EXCHECK(ex_put_conn(exoid, EX_ELEM_BLOCK, 10, conn10, NULL, NULL));
+  EXCHECK(ex_put_conn(exoid, EX_ELEM_BLOCK, 11, conn11, NULL, NULL));
+
+  int nodes20[] = {1, 4, 8};
+  EXCHECK(ex_put_set_param(exoid, EX_NODE_SET, 20, 3, 0));
+  EXCHECK(ex_put_set(exoid, EX_NODE_SET, 20, nodes20, NULL));
+
+  EXCHECK(ex_put_variable_param(exoid, EX_GLOBAL, 2));
+  EXCHECK(ex_put_variable_param(exoid, EX_NODAL, 2));
+  EXCHECK(ex_put_variable_param(exoid, EX_ELEM_BLOCK, 2));
+  EXCHECK(ex_put_variable_param(exoid, EX_NODE_SET, 1));
+
+  double vals[NUM_VALS];
+  for (int step = 1; step <= NUM_STEP; step++) {
+    double time = step / 10.0;
+    EXCHECK(ex_put_time(exoid, step, &time));
+    fill_values(step, vals);
+    EXCHECK(ex_put_vars(exoid, step, NUM_VARS, vars, vals));
+  }
+
+  /* Invalid variable index and unknown block id must fail */
+  ex_var bad_index[] = {{EX_ELEM_BLOCK, 10, 3, 2}};
+  ex_var bad_id[]    = {{EX_ELEM_BLOCK, 99, 1, 2}};
+  int    errors      = 0;
+  if (ex_put_vars(exoid, 1, 1, bad_index, vals) >= 0) {
+    fprintf(stderr, "ex_put_vars accepted an invalid variable index\n");
+    errors++;
+  }
+  if (ex_put_vars(exoid, 1, 1, bad_id, vals) >= 0) {
+    fprintf(stderr, "ex_put_vars accepted an unknown element block id\n");
+    errors++;
+  }
+  EXCHECK(ex_close(exoid));
+
+  /* Read the values back, all at once and one variable at a time */
+  float version;
+  exoid = ex_open("test-vars.exo", EX_READ, &CPU_word_size, &IO_word_size, &version);
+  printf("after ex_open for test-vars.exo, exoid = %d\n", exoid);
+  if (exoid < 0) {
+    exit(-1);
+  }
+
+  double expected[NUM_VALS];
+  for (int step = 1; step <= NUM_STEP; step++) {
+    fill_values(step, expected);
+
+    EXCHECK(ex_get_vars(exoid, step, NUM_VARS, vars, vals));
+    errors += compare_values("ex_get_vars", step, expected, vals);
+
+    int n = 0;
+    for (int i = 0; i < NUM_VARS; i++) {
+      EXCHECK(ex_get_var(exoid, step, vars[i].type, vars[i].var_index, vars[i].id,
+                         vars[i].num_entry, &vals[n]));
+      n += vars[i].num_entry;
+    }
+    errors += compare_values("ex_get_var", step, expected, vals);
+  }
+
+  if (ex_get_vars(exoid, 1, 1, bad_index, vals) >= 0) {
+    fprintf(stderr, "ex_get_vars accepted an invalid variable index\n");
+    errors++;
+  }
+  if (ex_get_vars(exoid, 1, 1, bad_id, vals) >= 0) {
+    fprintf(stderr, "ex_get_vars accepted an unknown element block id\n");
+    errors++;
+  }
+  EXCHECK(ex_close(exoid));
+
+  printf("test-put-get-vars: %d errors\n", errors);
+  return errors == 0 ? 0 : 1;
+}
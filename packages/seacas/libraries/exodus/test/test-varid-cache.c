@@ -0,0 +1,225 @@
+/*
+ * Copyright(C) 1999-2022 National Technology & Engineering Solutions
+ * of Sandia, LLC (NTESS).  Under the terms of Contract DE-NA0003525 with
+ * NTESS, the U.S. Government retains certain rights in this software.
+ *
+ * See packages/seacas/LICENSE for details
+ */
+/*****************************************************************************
+ *
+ * test-varid-cache - check that the per-file cache of results variable
+ *                    ids never hands out an id that belongs to another
+ *                    file, or to a file that was closed and re-created
+ *                    (and is likely to get the same exoid) with its
+ *                    blocks in a different order and different variables.
+ *
+ *****************************************************************************/
+
+#include "exodusII.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define STRINGIFY(x) #x
+#define TOSTRING(x)  STRINGIFY(x)
+
+#define EXCHECK(funcall)                                                                           \
+  do {                                                                                             \
+    int error = (funcall);                                                                         \
+    printf("after %s, error = %d\n", TOSTRING(funcall), error);                                    \
+    if (error != EX_NOERR) {                                                                       \
+      fprintf(stderr, "Error calling %s\n", TOSTRING(funcall));                                    \
+      ex_close(exoid);                                                                             \
+      exit(-1);                                                                                    \
+    }                                                                                              \
+  } while (0)
+
+#define MAX_BLK 3
+#define MAX_VAR 3
+#define MAX_ELE 4
+
+struct model
+{
+  const char *name;
+  int         tag; /* distinguishes the values of different files */
+  int         num_blk;
+  int         ids[MAX_BLK];
+  int         num_elem[MAX_BLK];
+  int         num_var;
+  int         truth[MAX_BLK * MAX_VAR];
+};
+
+/* File "a", and file "b" which is first created with the same name as "a" */
+static const struct model model_a = {
+    "test-varid-a.exo", 1, 3, {10, 20, 30}, {1, 2, 3}, 2, {1, 1, 1, 0, 1, 1}};
+static const struct model model_b = {
+    "test-varid-b.exo", 2, 3, {30, 10, 20}, {3, 1, 2}, 3, {1, 1, 1, 1, 0, 1, 0, 1, 1}};
+
+static double value(const struct model *m, int blk, int var, int elem)
+{
+  return m->tag * 10000.0 + m->ids[blk] * 100.0 + var * 10.0 + elem;
+}
+
+/* Creates a strip of quads with one element block per entry of `m->ids` */
+static int create_file(const struct model *m, const char *name)
+{
+  int CPU_word_size = 8;
+  int IO_word_size  = 8;
+  int exoid         = ex_create(name, EX_CLOBBER, &CPU_word_size, &IO_word_size);
+  printf("after ex_create for %s, exoid = %d\n", name, exoid);
+  if (exoid < 0) {
+    exit(-1);
+  }
+
+  int num_elem = 0;
+  for (int b = 0; b < m->num_blk; b++) {
+    num_elem += m->num_elem[b];
+  }
+  int num_nodes = 2 * (num_elem + 1);
+  EXCHECK(ex_put_init(exoid, "varid cache test", 2, num_nodes, num_elem, m->num_blk, 0, 0));
+
+  double x[2 * (MAX_BLK * MAX_ELE + 1)];
+  double y[2 * (MAX_BLK * MAX_ELE + 1)];
+  for (int i = 0; i <= num_elem; i++) {
+    x[i]                = i;
+    y[i]                = 0.0;
+    x[num_elem + 1 + i] = i;
+    y[num_elem + 1 + i] = 1.0;
+  }
+  EXCHECK(ex_put_coord(exoid, x, y, NULL));
+
+  int elem = 0;
+  for (int b = 0; b < m->num_blk; b++) {
+    int conn[4 * MAX_ELE];
+    for (int e = 0; e < m->num_elem[b]; e++, elem++) {
+      conn[4 * e + 0] = elem + 1;
+      conn[4 * e + 1] = elem + 2;
+      conn[4 * e + 2] = num_elem + elem + 3;
+      conn[4 * e + 3] = num_elem + elem + 2;
+    }
+    EXCHECK(ex_put_block(exoid, EX_ELEM_BLOCK, m->ids[b], "QUAD4", m->num_elem[b], 4, 0, 0, 0));
+    EXCHECK(ex_put_conn(exoid, EX_ELEM_BLOCK, m->ids[b], conn, NULL, NULL));
+  }
+
+  EXCHECK(ex_put_variable_param(exoid, EX_ELEM_BLOCK, m->num_var));
+  EXCHECK(ex_put_truth_table(exoid, EX_ELEM_BLOCK, m->num_blk, m->num_var, (int *)m->truth));
+
+  double time = 0.0;
+  EXCHECK(ex_put_time(exoid, 1, &time));
+  for (int b = 0; b < m->num_blk; b++) {
+    for (int v = 0; v < m->num_var; v++) {
+      if (m->truth[b * m->num_var + v]) {
+        double vals[MAX_ELE];
+        for (int e = 0; e < m->num_elem[b]; e++) {
+          vals[e] = value(m, b, v + 1, e);
+        }
+        EXCHECK(ex_put_var(exoid, 1, EX_ELEM_BLOCK, v + 1, m->ids[b], m->num_elem[b], vals));
+      }
+    }
+  }
+  return exoid;
+}
+
+static int open_file(const char *name)
+{
+  int   CPU_word_size = 8;
+  int   IO_word_size  = 0;
+  float version;
+  int   exoid = ex_open(name, EX_READ, &CPU_word_size, &IO_word_size, &version);
+  printf("after ex_open for %s, exoid = %d\n", name, exoid);
+  if (exoid < 0) {
+    exit(-1);
+  }
+  return exoid;
+}
+
+/* Reads every variable of every block of `m` and checks the values; variables
+ * that are not defined by the truth table must fail every time. */
+static int check_file(int exoid, const struct model *m)
+{
+  int errors = 0;
+  for (int b = 0; b < m->num_blk; b++) {
+    for (int v = 0; v < m->num_var; v++) {
+      double vals[MAX_ELE];
+      int    status = ex_get_var(exoid, 1, EX_ELEM_BLOCK, v + 1, m->ids[b], m->num_elem[b], vals);
+      if (!m->truth[b * m->num_var + v]) {
+        if (status >= 0) {
+          fprintf(stderr, "%s: read undefined variable %d on block %d\n", m->name, v + 1,
+                  m->ids[b]);
+          errors++;
+        }
+        continue;
+      }
+      if (status != EX_NOERR) {
+        fprintf(stderr, "%s: failed to read variable %d on block %d\n", m->name, v + 1, m->ids[b]);
+        errors++;
+        continue;
+      }
+      for (int e = 0; e < m->num_elem[b]; e++) {
+        if (vals[e] != value(m, b, v + 1, e)) {
+          fprintf(stderr, "%s: variable %d on block %d, element %d is %g, expected %g\n", m->name,
+                  v + 1, m->ids[b], e, vals[e], value(m, b, v + 1, e));
+          errors++;
+        }
+      }
+    }
+  }
+  return errors;
+}
+
+static int check_hits(int exoid, const char *name)
+{
+  int hits   = ex_inquire_int(exoid, EX_INQ_VARID_CACHE_HITS);
+  int misses = ex_inquire_int(exoid, EX_INQ_VARID_CACHE_MISSES);
+  printf("%s: %d varid cache hits, %d misses\n", name, hits, misses);
+  if (hits <= 0) {
+    fprintf(stderr, "%s: varid cache was not used\n", name);
+    return 1;
+  }
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  ex_opts(EX_VERBOSE);
+
+  int errors = 0;
+
+  /* Write and read file "a", twice so that the second pass uses the cache */
+  int exoid = create_file(&model_a, model_a.name);
+  errors += check_file(exoid, &model_a);
+  errors += check_file(exoid, &model_a);
+  errors += check_hits(exoid, model_a.name);
+  EXCHECK(ex_close(exoid));
+
+  /* Re-create file "a" with the layout of "b"; the exoid is likely reused */
+  struct model model_ab = model_b;
+  model_ab.name         = model_a.name;
+  exoid                 = create_file(&model_ab, model_ab.name);
+  errors += check_file(exoid, &model_ab);
+  errors += check_file(exoid, &model_ab);
+  EXCHECK(ex_close(exoid));
+
+  /* Re-create file "a" with its original layout, and write file "b" */
+  exoid = create_file(&model_a, model_a.name);
+  EXCHECK(ex_close(exoid));
+  exoid = create_file(&model_b, model_b.name);
+  EXCHECK(ex_close(exoid));
+
+  /* Read both files while both are open, interleaving the reads */
+  int exoid_a = open_file(model_a.name);
+  int exoid_b = open_file(model_b.name);
+  for (int pass = 0; pass < 2; pass++) {
+    errors += check_file(exoid_a, &model_a);
+    errors += check_file(exoid_b, &model_b);
+  }
+  errors += check_hits(exoid_a, model_a.name);
+  errors += check_hits(exoid_b, model_b.name);
+  exoid = exoid_a;
+  EXCHECK(ex_close(exoid_a));
+  exoid = exoid_b;
+  EXCHECK(ex_close(exoid_b));
+
+  printf("test-varid-cache: %d errors\n", errors);
+  return errors == 0 ? 0 : 1;
+}
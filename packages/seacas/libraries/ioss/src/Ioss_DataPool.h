@@ -6,11 +6,56 @@
 
 #pragma once
 #include <Ioss_CodeTypes.h>
+#include <algorithm>
+#include <cstddef>
 #include <cstdlib>
+#include <memory>
 #include <vector>
 
 struct DataPool
 {
+  // Grow-only scratch arena used for pointer-based field transfers.
+  // The storage is reused across fields and steps; it is only
+  // reallocated when a larger request is made, and is never
+  // zero-filled.  The returned pointer is suitably aligned for any
+  // field type and is invalidated by the next call to `get`.
+  template <typename T = char> T *get(size_t count)
+  {
+    size_t bytes = count * sizeof(T);
+    if (bytes > arena_capacity) {
+      size_t words = (bytes + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t);
+      arena.reset(); // Release old storage before allocating the new...
+      arena.reset(new std::max_align_t[words]);
+      arena_capacity = words * sizeof(std::max_align_t);
+    }
+    high_water_mark = std::max(high_water_mark, bytes);
+    return reinterpret_cast<T *>(arena.get());
+  }
+
+  // If `memory_limit` is non-zero and the arena has grown beyond it to
+  // hold a single large field, release the storage so that it is not
+  // retained for the remaining (smaller) transfers.
+  void trim()
+  {
+    if (memory_limit > 0 && arena_capacity > memory_limit) {
+      release();
+    }
+  }
+
+  void release()
+  {
+    arena.reset();
+    arena_capacity = 0;
+  }
+
+  size_t capacity() const { return arena_capacity; }
+
+  // Largest request made of the arena, in bytes.
+  size_t high_water_mark{0};
+
+  // If non-zero, the maximum number of bytes the arena retains between transfers.
+  size_t memory_limit{0};
+
   // Data space shared by most field input/output routines...
   std::vector<char>    data{};
   std::vector<int>     data_int{};
@@ -43,4 +88,8 @@ struct DataPool
   // Since Kokkos::initialize() has not yet been called. Also, a Kokkos:View cannot
   // have type std::complex entities.
 #endif
+
+private:
+  std::unique_ptr<std::max_align_t[]> arena{};
+  size_t                              arena_capacity{0};
 };
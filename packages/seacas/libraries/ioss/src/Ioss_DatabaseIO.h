@@ -107,6 +107,16 @@ namespace Ioss {
       return element_global_to_local__(global);
     }
 
+    /** \brief Get the map between the local and global ids of the nodes, edges, faces, or elements.
+     *
+     *  Intended for diagnostics.  Some databases do not define the map until the
+     *  "ids" field of the entities is read, and some do not use it at all.
+     *
+     *  \param[in] type One of NODEBLOCK, EDGEBLOCK, FACEBLOCK, or ELEMENTBLOCK.
+     *  \returns The map
+     */
+    const Ioss::Map &get_entity_map(Ioss::EntityType type) const;
+
     /** If there is a single block of nodes in the model, then it is
      *  considered a node_major() database.  If instead the nodes are
      * local to each element block or structured block, then it is
@@ -202,6 +212,13 @@ namespace Ioss {
      */
     virtual bool needs_shared_node_information() const { return false; }
 
+    /** \brief Determine whether the database can be accessed by one thread while another
+     *         thread accesses a different database.
+     *
+     *  \returns True if the library used to access the database is thread-safe.
+     */
+    virtual bool is_thread_safe() const { return false; }
+
     Ioss::IfDatabaseExistsBehavior open_create_behavior() const;
 
     void set_region(Region *region) { region_ = region; }
@@ -394,6 +411,19 @@ namespace Ioss {
       return retval;
     }
 
+    // If the database holds the data for 'field' in memory in the layout
+    // that get_field would return, point 'data' at it instead of copying.
+    // Otherwise 'data' is set to nullptr.
+    int64_t get_zc_field(const GroupingEntity *ge, const Field &field, void **data,
+                         size_t *data_size) const
+    {
+      IOSS_FUNC_ENTER(m_);
+      verify_and_log(ge, field, 1);
+      int64_t retval = get_zc_field_internal(ge, field, data, data_size);
+      verify_and_log(nullptr, field, 1);
+      return retval;
+    }
+
     /** Determine whether application will make field data get/put calls parallel consistently.
      *
      *  True is default and required for parallel-io databases.
@@ -781,6 +811,14 @@ namespace Ioss {
     virtual int64_t get_field_internal(const StructuredBlock * /*sb*/, const Field & /*field*/,
                                        void * /*data*/, size_t /*data_size*/) const = 0;
 
+    virtual int64_t get_zc_field_internal(const GroupingEntity * /*ge*/, const Field & /*field*/,
+                                          void **data, size_t *data_size) const
+    {
+      *data      = nullptr;
+      *data_size = 0;
+      return -1;
+    }
+
     virtual int64_t put_field_internal(const Region *reg, const Field &field, void *data,
                                        size_t data_size) const                      = 0;
     virtual int64_t put_field_internal(const NodeBlock *nb, const Field &field, void *data,
@@ -145,7 +145,8 @@ namespace Ioss {
     bool needs_centroids() const
     {
       return (m_method == "RCB" || m_method == "RIB" || m_method == "HSFC" ||
-              m_method == "GEOM_KWAY" || m_method == "KWAY_GEOM" || m_method == "METIS_SFC");
+              m_method == "GEOM_KWAY" || m_method == "KWAY_GEOM" || m_method == "METIS_SFC" ||
+              m_method == "HILBERT" || m_method == "MORTON");
     }
 
     void generate_entity_distributions(size_t globalNodeCount, size_t globalElementCount);
@@ -197,6 +198,18 @@ namespace Ioss {
 
     // Zero out some large arrays usually not needed after decomposition
     void release_memory();
+
+    // If the "DECOMPOSITION_CACHE" property is set, load the
+    // element-to-processor assignment saved by an earlier run on the
+    // same mesh file, processor count, and decomposition method.  If
+    // it returns true, `decompose_model` uses the saved assignment
+    // instead of running the decomposition method (and centroids are
+    // not needed).  Otherwise, the assignment calculated by
+    // `decompose_model` is saved for the next run.  Must be called on
+    // all processors after `generate_entity_distributions`.
+    bool load_decomposition_cache(const std::string &mesh_filename);
+    void save_decomposition_cache() const;
+
     void decompose_model(
 #if !defined(NO_ZOLTAN_SUPPORT)
         Zoltan &zz,
@@ -206,6 +219,7 @@ namespace Ioss {
     void simple_decompose();
     void simple_node_decompose();
     void guided_decompose();
+    void sfc_decompose();
 
     void calculate_element_centroids(const std::vector<double> &x, const std::vector<double> &y,
                                      const std::vector<double> &z);
@@ -597,7 +611,12 @@ namespace Ioss {
     bool m_showProgress{false};
     bool m_showHWM{false};
 
-    std::vector<INT>    m_elementToProc; // Used by "MAP" scheme...
+    bool        m_useCache{false};    // "DECOMPOSITION_CACHE" property
+    bool        m_cacheLoaded{false}; // Decomposition came from the cache file
+    std::string m_cacheFilename{};
+    std::string m_meshFilename{};
+
+    std::vector<INT>    m_elementToProc; // Used by "MAP", "VARIABLE", "HILBERT", "MORTON", cache.
     std::vector<double> m_centroids;
     std::vector<INT>    m_pointer;   // Index into adjacency, processor list for each element...
     std::vector<INT>    m_adjacency; // Size is sum of element connectivity sizes
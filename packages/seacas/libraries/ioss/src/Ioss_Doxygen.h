@@ -28,6 +28,7 @@ For bug reports, documentation errors, and enhancement suggestions, contact:
  IGNORE_ATTRIBUTE_NAMES   | on/[off] | Do not read the attribute names that may exist on an input database. Instead for an element block with N attributes, the fields will be named `attribute_1` ... `attribute_N`
  MINIMIZE_OPEN_FILES | on/[off] | If on, then close file after each timestep and then reopen on next output
  SERIALIZE_IO | integer | The number of files that will be read/written to simultaneously in a  parallel file-per-rank run.
+ FACE_GENERATION_THREADS | integer [1] | The number of threads `Ioss::FaceGenerator` uses to build the element faces (skinning, CGNS boundary output).
 
 ## Auto-Decomposition-Related Properties
 
@@ -40,6 +41,8 @@ PARALLEL_CONSISTENCY | [on]/off | On if the client will call Ioss functions cons
 RETAIN_FREE_NODES | [on]/off | In auto-decomp, will nodes not connected to any elements be retained.
 LOAD_BALANCE_THRESHOLD | {real} [1.4] | CGNS-Structured only -- Load imbalance permitted Load on Proc / Avg Load
 DECOMPOSITION_EXTRA | {name},{multiplier} | Specify the name of the element map or variable used if the decomposition method is `map` or `variable`.  If it contains a comma, the value following the comma is used to scale (divide) the values in the map/variable.  If it is 'auto', then all values will be scaled by `max_value/processorCount`
+DECOMPOSITION_CACHE | on/[off] | Exodus only -- Save the element-to-processor assignment calculated by the decomposition method in `{mesh}.{method}.{processor_count}.dcache` next to the mesh and reuse it on later runs if the mesh file size and modification time are unchanged.  Not used with the `linear`, `map`, or `variable` methods.
+BATCH_TRANSIENT_READS | on/[off] | Exodus only -- On the first read of a nodal or element variable at a step, read all nodal (or element) variables for that step and redistribute them with a single communication. Later reads of that type at the same step use the saved values.  Uses memory proportional to the number of variables.
 
 ### Valid values for Decomposition Method
 
@@ -52,6 +55,8 @@ metis_sfc  | metis space-filling-curve
 kway       | metis kway graph-based
 kway_geom  | metis kway graph-based method with geometry speedup
 linear     | elements in order first n/p to proc 0, next to proc 1.
+hilbert    | elements sorted along a hilbert space-filling curve through their centroids; first n/p to proc 0, next to proc 1. Does not require Zoltan.
+morton     | same as `hilbert`, but using a morton (z-order) curve.
 cyclic     | elements handed out to id % proc_count
 random     | elements assigned randomly to processors in a way that preserves balance (do not use for a real run)
 map        | the specified element map contains the mapping of elements to processor. Uses 'processor_id' map by default; otherwise specify name with `DECOMPOSITION_EXTRA` property
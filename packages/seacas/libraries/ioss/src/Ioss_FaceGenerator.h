@@ -118,6 +118,10 @@ namespace Ioss {
     //! Given a local node id (0-based), return the hashed value.
     size_t node_id_hash(size_t local_node_id) const { return hashIds_[local_node_id]; }
 
+    //! Number of threads used to generate the faces.  Set by the
+    //! `FACE_GENERATION_THREADS` property of the region's database.
+    int thread_count() const { return threadCount_; }
+
   private:
     template <typename INT> void hash_node_ids(const std::vector<INT> &node_ids);
     template <typename INT> void generate_block_faces(INT /*dummy*/, bool local_ids);
@@ -126,6 +130,7 @@ namespace Ioss {
     Ioss::Region                           &region_;
     std::map<std::string, FaceUnorderedSet> faces_;
     std::vector<size_t>                     hashIds_;
+    int                                     threadCount_{1};
   };
 
 } // namespace Ioss
@@ -201,6 +201,16 @@ namespace Ioss {
 
     int64_t put_field_data(const std::string &field_name, void *data, size_t data_size) const;
 
+    // Zero-copy access to this fields data.  If the database holds the
+    // data in memory in exactly the layout that would be returned by the
+    // copying get_field_data functions, set 'data' to point to that
+    // storage and 'data_size' to its size in bytes and return the number
+    // of entities.  Otherwise, set 'data' to nullptr and return -1; the
+    // caller must then use one of the copying functions.
+    // The storage is owned by the database and must not be modified; it
+    // is only valid until the database is modified or closed.
+    int64_t get_field_data(const std::string &field_name, void **data, size_t *data_size) const;
+
     // Put this fields data into the specified std::vector space.
     // Returns number of entities for which the field was read.
     // Resizes 'data' to size needed to hold all values.
@@ -283,6 +293,8 @@ namespace Ioss {
                                             size_t data_size = 0) const = 0;
     virtual int64_t internal_put_field_data(const Field &field, void *data,
                                             size_t data_size = 0) const = 0;
+    virtual int64_t internal_get_zc_field_data(const Field &field, void **data,
+                                               size_t *data_size) const;
 
     int64_t entityCount = 0;
 
@@ -12,15 +12,6 @@
 #include <string>  // for string
 #include <vector>  // for vector
 
-#define MAP_USE_HOPSCOTCH
-#if defined MAP_USE_STD
-#include <unordered_map>
-#elif defined MAP_USE_HOPSCOTCH
-#include <bhopscotch_map.h>
-#elif defined MAP_USE_ROBIN
-#include <robin_map.h>
-#endif
-
 namespace Ioss {
   class Field;
 } // namespace Ioss
@@ -28,17 +19,93 @@ namespace Ioss {
 namespace Ioss {
 
   using MapContainer = std::vector<int64_t>;
-#if defined MAP_USE_STD
-  using ReverseMapContainer = std::unordered_map<int64_t, int64_t>;
-#elif defined MAP_USE_HOPSCOTCH
-  // The `b` variant requires less-than-comparable key, but is faster
-  using ReverseMapContainer = tsl::bhopscotch_map<int64_t, int64_t>;
-  // using ReverseMapContainer = tsl::hopscotch_map<int64_t, int64_t>;
-  // using ReverseMapContainer = tsl::hopscotch_pg_map<int64_t, int64_t>;
-#elif defined MAP_USE_ROBIN
-  using ReverseMapContainer = tsl::robin_map<int64_t, int64_t>;
-  // using ReverseMapContainer = tsl::robin_pg_map<int64_t, int64_t>;
-#endif
+
+  // Global-to-local id lookup for a `Map` whose ids are not sequential.
+  //
+  // The ids are stored as ranges of consecutive global ids assigned to
+  // consecutive local ids, so maps which are sequential in pieces (the
+  // usual case for decomposed or concatenated meshes) need one small
+  // entry per range instead of one per id.  Once there are too many
+  // ranges for that to be compact, the ids are moved to a flat
+  // open-addressing hash table which stores the global and local id
+  // inline so that a lookup touches a single cache line.
+  class ReverseMapContainer
+  {
+  public:
+    bool   empty() const { return m_size == 0; }
+    size_t size() const { return m_size; }
+
+    void clear();
+    void swap(ReverseMapContainer &other) noexcept;
+
+    // Hint that the container will hold `count` ids.
+    void reserve(size_t count);
+
+    // Maps `global` (which must be nonzero) to `local`.  If `global`
+    // is already in the container, it is not changed and the local id
+    // it maps to is returned; otherwise returns 0.
+    int64_t insert(int64_t global, int64_t local);
+
+    // Returns the local id of `global`, or 0 if it is not in the container.
+    int64_t find(int64_t global) const
+    {
+      if (!m_hashed) {
+        return find_range(global);
+      }
+      size_t mask = m_slots.size() - 1;
+      for (size_t i = slot_index(global);; i = (i + 1) & mask) {
+        const auto &slot = m_slots[i];
+        if (slot.global == global) {
+          return slot.local;
+        }
+        if (slot.global == 0) {
+          return 0;
+        }
+      }
+    }
+
+    // Number of ranges the ids are stored as, or 0 if they are hashed.
+    size_t range_count() const { return m_hashed ? 0 : m_ranges.size(); }
+
+    // Bytes allocated for the ids.
+    size_t memory() const;
+
+    // Bytes the hash table would allocate for `count` ids.
+    static size_t hashed_memory(size_t count);
+
+  private:
+    struct Range
+    {
+      int64_t global;
+      int64_t local;
+      int64_t count;
+    };
+
+    struct Slot
+    {
+      int64_t global; // 0 if the slot is empty
+      int64_t local;
+    };
+
+    int64_t insert_range(int64_t global, int64_t local);
+    int64_t insert_hashed(int64_t global, int64_t local);
+    int64_t find_range(int64_t global) const;
+    void    rehash(size_t count);
+
+    // Fibonacci hashing; spreads the runs of nearby ids common in meshes.
+    size_t slot_index(int64_t global) const
+    {
+      return (static_cast<uint64_t>(global) * 0x9E3779B97F4A7C15ULL) >> m_shift;
+    }
+
+    std::vector<Range> m_ranges{}; // Sorted by global id; disjoint.
+    std::vector<Slot>  m_slots{};  // Power of two in size, once hashed.
+    size_t             m_size{0};
+    size_t             m_reserve{0};
+    size_t             m_last{0};  // Index of the range last added to.
+    int                m_shift{0}; // Hash is the top 64 - m_shift bits of the product.
+    bool               m_hashed{false};
+  };
 
   class Map
   {
@@ -78,6 +145,11 @@ namespace Ioss {
     void map_data(void *data, const Ioss::Field &field, size_t count) const;
     void map_implicit_data(void *data, const Ioss::Field &field, size_t count, size_t offset) const;
 
+    // If the global ids of the local entities offset+1..offset+count are
+    // stored explicitly (the map is not sequential), return a pointer to
+    // them; otherwise return nullptr since they are generated on demand.
+    const int64_t *implicit_data_view(size_t count, size_t offset) const;
+
     template <typename T>
     size_t map_field_to_db_scalar_order(T *variables, std::vector<double> &db_var,
                                         size_t begin_offset, size_t count, size_t stride,
@@ -86,6 +158,10 @@ namespace Ioss {
     const MapContainer &map() const { return m_map; }
     MapContainer       &map() { return m_map; }
 
+    // Empty if the map is sequential or the global-to-local lookup
+    // has not been built.
+    const ReverseMapContainer &reverse_map() const { return m_reverse; }
+
     bool defined() const { return m_defined; }
     void set_defined(bool yes_no) { m_defined = yes_no; }
 
@@ -6,6 +6,7 @@
  *
  * See packages/seacas/LICENSE for details
  */
+#include <cstddef>
 #include <vector>
 
 namespace Ioss {
@@ -16,6 +17,18 @@ namespace Ioss {
     double              maximum_time{0.0};
     double              delay{0.0};
 
+    // If non-zero, the maximum number of bytes of field transfer scratch
+    // memory retained between field transfers.  A single field larger
+    // than this is still transferred, but its storage is then released.
+    size_t memory_limit{0};
+
+    // If non-zero, a separate thread reads up to this many steps ahead
+    // of the step being written during the transient transfer.  Ignored in
+    // parallel, unless both databases are thread-safe, and if both use the
+    // same library (exodus serializes all calls).  Reduced if the buffered
+    // steps would exceed `memory_limit`.
+    int pipeline_depth{0};
+
     // POINTER=1, STD_VECTOR=2, KOKKOS_VIEW_1D=3, KOKKOS_VIEW_2D=4,
     // KOKKOS_VIEW_2D_LAYOUTRIGHT_HOSTSPACE=5
     int  data_storage_type{0};
@@ -19,6 +19,7 @@
 #include <iosfwd>          // for ostream
 #include <map>             // for map, map<>::value_compare
 #include <string>          // for string, operator<
+#include <unordered_map>   // for unordered_map
 #include <utility>         // for pair
 #include <vector>          // for vector
 namespace Ioss {
@@ -66,6 +67,9 @@ namespace Ioss {
 
   using AliasMap = std::map<std::string, std::string, std::less<std::string>>;
 
+  using EntityNameIndex = std::unordered_map<std::string, GroupingEntity *>;
+  using EntityIdIndex   = std::unordered_map<int64_t, GroupingEntity *>;
+
   /** \brief A grouping entity that contains other grouping entities.
    *
    * Maintains a list of NodeBlocks, ElementBlocks, NodeLists, CommLists and Surfaces.
@@ -272,6 +276,10 @@ namespace Ioss {
     bool add_alias__(const std::string &db_name, const std::string &alias, EntityType type);
     bool add_alias__(const GroupingEntity *ge);
 
+    // Lookups through the name and id indexes. Not protected by mutex.
+    GroupingEntity *get_entity__(const std::string &my_name, EntityType io_type) const;
+    void            index_entity__(GroupingEntity *entity);
+
     bool begin_mode__(State new_state);
     bool end_mode__(State current_state);
 
@@ -279,6 +287,12 @@ namespace Ioss {
 
     mutable std::map<EntityType, AliasMap> aliases_; ///< Stores alias mappings
 
+    // Entities of each type by name and by "id" property.  An index is
+    // rebuilt when a lookup misses since ids may be assigned or changed,
+    // and entities renamed, after an entity is added.
+    mutable std::map<EntityType, EntityNameIndex> nameIndex_;
+    mutable std::map<EntityType, EntityIdIndex>   idIndex_;
+
     // Containers for all grouping entities
     NodeBlockContainer    nodeBlocks;
     EdgeBlockContainer    edgeBlocks;
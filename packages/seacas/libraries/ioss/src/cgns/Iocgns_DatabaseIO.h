@@ -209,6 +209,7 @@ namespace Iocgns {
     mutable std::vector<double>                           m_timesteps;
     std::vector<CGNSIntVector>                            m_blockLocalNodeMap;
     std::map<std::string, int>                            m_zoneNameMap;
+    SolutionIndexMap                                      m_solutionIndexMap; // Built on input
     mutable std::map<int, Ioss::Map *>                    m_globalToBlockLocalNodeMap;
     mutable std::map<std::string, Ioss::FaceUnorderedSet> m_boundaryFaces;
   };
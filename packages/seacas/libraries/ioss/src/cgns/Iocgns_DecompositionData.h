@@ -32,6 +32,7 @@
 #include <Ioss_MeshType.h>
 #include <Ioss_PropertyManager.h>
 #include <Ioss_StructuredBlock.h>
+#include <cgns/Iocgns_Defines.h>
 #include <cgns/Iocgns_StructuredZoneData.h>
 
 #include <cgnslib.h>
@@ -94,7 +95,8 @@ namespace Iocgns {
     void get_element_field(int filePtr, int solution_index, int blk_seq, int field_index,
                            double *data) const;
 
-    void get_node_field(int filePtr, int step, int field_index, double *data) const;
+    void get_node_field(int filePtr, const SolutionIndexMap &solution_map, int step,
+                        int field_index, double *data) const;
 
     void get_node_entity_proc_data(void *entity_proc, const Ioss::MapContainer &node_map,
                                    bool do_map) const;
@@ -182,7 +184,8 @@ namespace Iocgns {
     void get_element_field(int filePtr, int solution_index, int blk_seq, int field_index,
                            double *data) const;
 
-    void get_node_field(int filePtr, int step, int field_offset, double *data) const;
+    void get_node_field(int filePtr, const SolutionIndexMap &solution_map, int step,
+                        int field_offset, double *data) const;
 
     size_t get_commset_node_size() const override
     {
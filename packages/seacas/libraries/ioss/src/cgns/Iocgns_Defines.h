@@ -5,8 +5,17 @@
 // See packages/seacas/LICENSE for details
 
 #pragma once
+#include <cgnslib.h>
 #include <cgnstypes.h>
+#include <map>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #define CGNS_MAX_NAME_LENGTH 255
 using CGNSIntVector = std::vector<cgsize_t>;
+
+// The FlowSolution_t node index of each step, keyed by (zone, location).
+// See Iocgns::Utils::build_solution_index_map().
+using SolutionIndexMap =
+    std::map<std::pair<int, CGNS_ENUMT(GridLocation_t)>, std::unordered_map<int, int>>;
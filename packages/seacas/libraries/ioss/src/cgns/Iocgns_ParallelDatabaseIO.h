@@ -225,6 +225,7 @@ namespace Iocgns {
         m_bcOffset; // The BC Section element offsets in unstructured output.
     mutable std::vector<double>        m_timesteps; // Should be able to get this from region?
     std::map<std::string, int>         m_zoneNameMap;
+    SolutionIndexMap                   m_solutionIndexMap; // Built on input
     mutable std::map<int, Ioss::Map *> m_globalToBlockLocalNodeMap;
     mutable CGNSIntVector
         m_elemGlobalImplicitMap; // Position of this element in the global-implicit ordering
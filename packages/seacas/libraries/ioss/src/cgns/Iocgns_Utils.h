@@ -251,8 +251,10 @@ namespace Iocgns {
                                              int state, const int *vertex_solution_index,
                                              const int *cell_center_solution_index,
                                              bool       is_parallel_io);
-    static int  find_solution_index(int cgns_file_ptr, int base, int zone, int step,
+    static int  find_solution_index(const SolutionIndexMap &solution_map, int zone, int step,
                                     CGNS_ENUMT(GridLocation_t) location);
+    static void build_solution_index_map(int cgns_file_ptr, int base,
+                                         SolutionIndexMap &solution_map);
     static Ioss::MeshType check_mesh_type(int cgns_file_ptr);
 
     static void output_assembly(int file_ptr, const Ioss::Assembly *assembly, bool is_parallel_io,
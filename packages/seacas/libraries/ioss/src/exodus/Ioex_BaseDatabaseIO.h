@@ -86,6 +86,8 @@ namespace Ioex {
     // database supports that type (e.g. return_value & Ioss::FACESET)
     unsigned entity_field_support() const override;
 
+    bool is_thread_safe() const override;
+
   protected:
     // Check to see if database state is ok...
     // If 'write_message' true, then output a warning message indicating the problem.
@@ -94,6 +94,8 @@ namespace Ioex {
     {
       return -1;
     }
+    int64_t get_zc_field_internal(const Ioss::GroupingEntity *ge, const Ioss::Field &field,
+                                  void **data, size_t *data_size) const override;
 
     int64_t get_field_internal(const Ioss::SideBlock *fb, const Ioss::Field &field, void *data,
                                size_t data_size) const override;
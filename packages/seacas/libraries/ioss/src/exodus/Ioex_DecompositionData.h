@@ -34,11 +34,11 @@ namespace Ioex {
   public:
     DecompositionDataBase(Ioss_MPI_Comm comm) : comm_(comm) {}
 
-    virtual ~DecompositionDataBase()            = default;
-    virtual int    int_size() const             = 0;
-    virtual void   decompose_model(int filePtr) = 0;
-    virtual size_t ioss_node_count() const      = 0;
-    virtual size_t ioss_elem_count() const      = 0;
+    virtual ~DecompositionDataBase()                                          = default;
+    virtual int    int_size() const                                           = 0;
+    virtual void   decompose_model(int filePtr, const std::string &filename) = 0;
+    virtual size_t ioss_node_count() const                                    = 0;
+    virtual size_t ioss_elem_count() const                                    = 0;
 
     virtual int    spatial_dimension() const = 0;
     virtual size_t global_node_count() const = 0;
@@ -62,6 +62,10 @@ namespace Ioex {
 
     const Ioss::SetDecompositionData &get_decomp_set(ex_entity_type type, ex_entity_id id) const;
 
+    // Location of the first element of element block `id` in the
+    // element-based (all blocks) ioss data on this processor.
+    size_t get_block_ioss_offset(ex_entity_id id) const;
+
     template <typename T>
     void communicate_node_data(T *file_data, T *ioss_data, size_t comp_count) const;
 
@@ -92,6 +96,8 @@ namespace Ioex {
                          double *attrib) const                               = 0;
     virtual int get_var(int filePtr, int step, ex_entity_type type, int var_index, ex_entity_id id,
                         int64_t num_entity, std::vector<double> &data) const = 0;
+    virtual int get_all_vars(int filePtr, int step, ex_entity_type type, int var_count,
+                             std::vector<double> &data) const                = 0;
   };
 
   template <typename INT> class DecompositionData : public DecompositionDataBase
@@ -102,7 +108,7 @@ namespace Ioex {
 
     int int_size() const { return sizeof(INT); }
 
-    void decompose_model(int filePtr);
+    void decompose_model(int filePtr, const std::string &filename);
 
     int spatial_dimension() const { return m_decomposition.m_spatialDimension; }
 
@@ -150,6 +156,14 @@ namespace Ioex {
     int get_var(int filePtr, int step, ex_entity_type type, int var_index, ex_entity_id id,
                 int64_t num_entity, std::vector<double> &data) const;
 
+    // Read all `var_count` nodal or element variables at `step` and
+    // move them to the ioss decomposition with a single all-to-all.
+    // The values are interleaved by entity (`var_count` values per
+    // node/element); elements are in block order, and variables not
+    // defined on a block are zero.
+    int get_all_vars(int filePtr, int step, ex_entity_type type, int var_count,
+                     std::vector<double> &data) const;
+
     template <typename T>
     int get_set_mesh_var(int filePtr, ex_entity_type type, ex_entity_id id,
                          const Ioss::Field &field, T *ioss_data) const;
@@ -174,6 +174,8 @@ namespace Ioex {
     int64_t read_transient_field(ex_entity_type type, const Ioex::VariableNameMap &variables,
                                  const Ioss::Field &field, const Ioss::GroupingEntity *ge,
                                  void *data) const;
+    int     get_batched_var(ex_entity_type type, int step, int var_index, int64_t id,
+                            std::vector<double> &data) const;
 
     int64_t read_attribute_field(ex_entity_type type, const Ioss::Field &field,
                                  const Ioss::GroupingEntity *ge, void *data) const;
@@ -253,9 +255,21 @@ namespace Ioex {
     // for a GroupingEntity* which is a NodeSet*
     mutable std::map<const Ioss::GroupingEntity *, Ioss::Int64Vector> nodesetOwnedNodes;
 
+    // If "BATCH_TRANSIENT_READS" is set, all nodal or element variables
+    // for a step are read and communicated together on the first request
+    // for one of them; later requests for that step use these values.
+    struct BatchedVariables
+    {
+      int                 step{-1};
+      int                 varCount{0};
+      std::vector<double> values{}; // `varCount` values per node or element
+    };
+    mutable std::map<ex_entity_type, BatchedVariables> batchedVariables;
+
     mutable bool metaDataWritten{false};
     mutable bool nodeGlobalImplicitMapDefined{false};
     mutable bool elemGlobalImplicitMapDefined{false};
+    bool         batchTransientReads{false};
   };
 } // namespace Ioex
 #endif
@@ -77,6 +77,9 @@ namespace Iogn {
     // database supports that type (e.g. return_value & Ioss::FACESET)
     unsigned entity_field_support() const override;
 
+    // The mesh is generated in memory; no library is involved.
+    bool is_thread_safe() const override { return true; }
+
     int int_byte_size_db() const override { return int_byte_size_api(); }
 
     const GeneratedMesh *get_generated_mesh() const { return m_generatedMesh; }
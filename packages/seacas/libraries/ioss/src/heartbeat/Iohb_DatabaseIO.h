@@ -15,6 +15,7 @@
 #include <cstddef>           // for size_t
 #include <cstdint>           // for int64_t
 #include <iostream>          // for ostream
+#include <memory>            // for unique_ptr
 #include <string>            // for string
 namespace Iohb {
   class CommSet;
@@ -26,6 +26,7 @@ namespace Info {
     bool check_node_status() const { return checkNodeStatus_; }
     bool compute_volume() const { return computeVolume_; }
     bool compute_bbox() const { return computeBBox_; }
+    bool map_memory() const { return mapMemory_; }
     bool adjacencies() const { return adjacencies_; }
     bool ints_64_bit() const { return ints64Bit_; }
     bool list_groups() const { return listGroups_; }
@@ -56,6 +57,7 @@ namespace Info {
     bool adjacencies_{false};
     bool ints64Bit_{false};
     bool computeBBox_{false};
+    bool mapMemory_{false};
     bool listGroups_{false};
     bool useGenericNames_{false};
     bool disableFieldRecognition_{false};
@@ -50,6 +50,8 @@ namespace IOShell {
     int                      compression_level{0};
     int                      serialize_io_size{0};
     int                      flush_interval{0};
+    int                      pipeline_depth{0};
+    size_t                   memory_limit{0};
 
     //! If non-empty, then it is a list of times that should be transferred to the output file.
     std::vector<double> selected_times{};
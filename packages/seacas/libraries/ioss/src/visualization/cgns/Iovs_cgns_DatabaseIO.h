@@ -8,6 +8,7 @@
 #define Iovs_cgns_DatabaseIO_h
 
 #include <Ioss_DatabaseIO.h>
+#include <memory>
 
 namespace Iovs_cgns {
   class CatalystCGNSMeshBase;
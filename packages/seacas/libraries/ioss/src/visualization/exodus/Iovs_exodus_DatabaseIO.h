@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <ctime>
 #include <map>
+#include <memory>
 #include <set>
 #include <sstream>
 #include <string>